@@ -0,0 +1,112 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/c/src/bintrace.c
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "bintrace.h"
+
+/* Creates a binary trace file and writes its header. */
+struct bin_trace *bin_trace_open(const char *path,
+                                 const unsigned int solver,
+                                 const unsigned int nvars,
+                                 const double rho,
+                                 const double epsilon) {
+
+    struct bin_trace        *t;
+    struct bin_trace_header  h;
+
+    t = malloc(sizeof(*t));
+
+    if (t == NULL) {
+        return NULL;
+    }
+
+    t->nvars  = nvars;
+    t->buffer = malloc(BIN_TRACE_BUFFER_SIZE);
+    t->file   = fopen(path, "wb");
+
+    if ((t->buffer == NULL) || (t->file == NULL)) {
+        if (t->file != NULL) {
+            fclose(t->file);
+        }
+
+        free(t->buffer);
+        free(t);
+
+        return NULL;
+    }
+
+    /* The records go out through a large stream buffer. */
+    setvbuf(t->file, t->buffer, _IOFBF, BIN_TRACE_BUFFER_SIZE);
+
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, BIN_TRACE_MAGIC, BIN_TRACE_MAGIC_SIZE);
+
+    h.version     = BIN_TRACE_VERSION;
+    h.solver      = solver;
+    h.nvars       = nvars;
+    h.record_size = sizeof(struct bin_trace_record) + nvars * sizeof(double);
+    h.rho         = rho;
+    h.epsilon     = epsilon;
+
+    fwrite(&h, sizeof(h), 1, t->file);
+
+    return t;
+}
+
+/* Writes one record (into the file stream buffer). */
+void bin_trace_record(struct bin_trace *__bin_trace,
+                      const unsigned int event,
+                      const unsigned int iters,
+                      const unsigned long funevals,
+                      const double fx,
+                      const double *x) {
+
+    struct bin_trace_record r;
+
+    r.event    = event;
+    r.iters    = iters;
+    r.funevals = funevals;
+    r.f        = fx;
+
+    fwrite(&r, sizeof(r), 1, __bin_trace->file);
+    fwrite(x, sizeof(double), __bin_trace->nvars, __bin_trace->file);
+}
+
+/* Writes out the buffered records and closes the binary trace file. */
+int bin_trace_close(struct bin_trace *__bin_trace) {
+    int status = (ferror(__bin_trace->file) != 0);
+
+    /* The stream buffer has to outlive the stream. */
+    if (fclose(__bin_trace->file) != 0) {
+        status = 1;
+    }
+
+    free(__bin_trace->buffer);
+    free(__bin_trace);
+
+    return status;
+}
+
+/* vim:set nu et ts=4 sw=4: */
@@ -0,0 +1,185 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/c/src/bintrace.h
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+/**
+ * The <code>bintrace.h</code> header file declares the binary trace
+ * writer: the solver progress as packed fixed-width records.
+ * <br />
+ * <br />The file starts with a 32-byte header (the magic bytes
+ * &quot;NLPT&quot;, the format version, the solver, the number
+ * of variables, the record size, rho and epsilon); each record is then
+ * the record kind, the iteration number, the number of function
+ * evaluations, f(x) and the nvars coordinates of x, in the byte order
+ * of the machine. The layout is the one of the C++ <code>BinaryTrace</code>
+ * class, so <code>hooke-tracedump</code> (of the C++ tree) turns a file
+ * back into the text layout or into CSV. The Nelder-Mead C tree builds
+ * this very writer too.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @since   hooke-jeeves 0.1
+ */
+
+#ifndef __C__BINTRACE_H
+#define __C__BINTRACE_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/** Constant. The magic bytes a binary trace file starts with. */
+#define BIN_TRACE_MAGIC "NLPT"
+
+/** Constant. The number of the magic bytes. */
+#define BIN_TRACE_MAGIC_SIZE 4
+
+/** Constant. The binary trace format version. */
+#define BIN_TRACE_VERSION 1
+
+/** Constant. The size of the file stream buffer (1 MiB). */
+#define BIN_TRACE_BUFFER_SIZE (1 << 20)
+
+/** Constants. The solvers. */
+#define BIN_TRACE_HOOKE  1
+#define BIN_TRACE_NELMIN 2
+
+/** Constants. The record kinds. */
+#define BIN_TRACE_ITERATION 0
+#define BIN_TRACE_SUMMARY   1
+
+/** The binary trace file header (32 bytes, no padding). */
+struct bin_trace_header {
+    /** The magic bytes (<code>BIN_TRACE_MAGIC</code>). */
+    char magic[BIN_TRACE_MAGIC_SIZE];
+
+    /** The format version (<code>BIN_TRACE_VERSION</code>). */
+    uint16_t version;
+
+    /** The solver (<code>BIN_TRACE_HOOKE</code> or ..._NELMIN). */
+    uint16_t solver;
+
+    /** The number of coordinates of every record. */
+    uint32_t nvars;
+
+    /** The size of a record in bytes. */
+    uint32_t record_size;
+
+    /** The rho value (0 for the Nelder-Mead solver). */
+    double rho;
+
+    /** The epsilon value (the reqmin one of Nelder-Mead). */
+    double epsilon;
+};
+
+/**
+ * The fixed part of a binary trace record (24 bytes, no padding);
+ * the nvars coordinates of the point follow it.
+ */
+struct bin_trace_record {
+    /** The record kind. */
+    uint32_t event;
+
+    /** The iteration number. */
+    uint32_t iters;
+
+    /** The number of function evaluations so far. */
+    uint64_t funevals;
+
+    /** The objective function value at the point. */
+    double f;
+};
+
+/*
+ * The C++ BinaryTrace class declares the same layout on its own
+ * (see hooke-jeeves/cc/src/bintrace.h), so both sides check it.
+ */
+_Static_assert(sizeof(struct bin_trace_header) == 32,
+               "The binary trace header has to be 32 bytes.");
+_Static_assert(offsetof(struct bin_trace_header, nvars) == 8,
+               "The binary trace header has to be packed.");
+_Static_assert(offsetof(struct bin_trace_header, rho) == 16,
+               "The binary trace header has to be packed.");
+_Static_assert(sizeof(struct bin_trace_record) == 24,
+               "The binary trace record has to be 24 bytes.");
+_Static_assert(offsetof(struct bin_trace_record, funevals) == 8,
+               "The binary trace record has to be packed.");
+
+/** The structure to hold an open binary trace file. */
+struct bin_trace {
+    /** The file. */
+    FILE *file;
+
+    /** The file stream buffer. */
+    char *buffer;
+
+    /** The number of coordinates of every record. */
+    unsigned int nvars;
+};
+
+/**
+ * Creates a binary trace file and writes its header.
+ *
+ * @param path    The file path.
+ * @param solver  The solver (<code>BIN_TRACE_HOOKE</code> or ..._NELMIN).
+ * @param nvars   The number of coordinates of every record.
+ * @param rho     The rho value.
+ * @param epsilon The epsilon value.
+ *
+ * @return The binary trace, or <code>NULL</code> if the file could not
+ *         be created.
+ */
+extern struct bin_trace *bin_trace_open(const char *,
+                                        const unsigned int,
+                                        const unsigned int,
+                                        const double,
+                                        const double);
+
+/**
+ * Writes one record (into the file stream buffer).
+ *
+ * @param __bin_trace The binary trace (struct *).
+ * @param event       The record kind.
+ * @param iters       The iteration number.
+ * @param funevals    The number of function evaluations so far.
+ * @param fx          The objective function value at the point.
+ * @param x           The point (nvars coordinates).
+ */
+extern void bin_trace_record(struct bin_trace *,
+                             const unsigned int,
+                             const unsigned int,
+                             const unsigned long,
+                             const double,
+                             const double *);
+
+/**
+ * Writes out the buffered records and closes the binary trace file.
+ *
+ * @param __bin_trace The binary trace (struct *).
+ *
+ * @return <code>0</code> if all the records got written.
+ */
+extern int bin_trace_close(struct bin_trace *);
+
+#endif /* __C__BINTRACE_H */
+
+/* vim:set nu et ts=4 sw=4: */
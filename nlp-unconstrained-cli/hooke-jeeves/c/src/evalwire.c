@@ -0,0 +1,260 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/c/src/evalwire.c
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+/* For socketpair(), fork() and usleep() (not in the C standard). */
+#define _DEFAULT_SOURCE
+
+#include <errno.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "evalwire.h"
+
+/*
+ * Helper function.
+ * Writes a whole buffer to a socket (a worker which has gone away
+ * makes it fail instead of raising SIGPIPE).
+ */
+static int send_full(const int fd, const char *buf, size_t size) {
+    ssize_t k;
+
+    while (size > 0) {
+        if ((k = send(fd, buf, size, MSG_NOSIGNAL)) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            return 0;
+        }
+
+        buf  += k;
+        size -= k;
+    }
+
+    return 1;
+}
+
+/* Helper function. Reads a whole buffer from a descriptor. */
+static int read_full(const int fd, char *buf, size_t size) {
+    ssize_t k;
+
+    while (size > 0) {
+        if ((k = read(fd, buf, size)) <= 0) {
+            if ((k < 0) && (errno == EINTR)) {
+                continue;
+            }
+
+            return 0;
+        }
+
+        buf  += k;
+        size -= k;
+    }
+
+    return 1;
+}
+
+/* Helper function. Writes a whole buffer to a descriptor. */
+static int write_full(const int fd, const char *buf, size_t size) {
+    ssize_t k;
+
+    while (size > 0) {
+        if ((k = write(fd, buf, size)) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            return 0;
+        }
+
+        buf  += k;
+        size -= k;
+    }
+
+    return 1;
+}
+
+/* Starts a worker. */
+int eval_spawn(const char *command, const char *problem, pid_t *pid) {
+    unsigned int nargs = 0;
+
+    int sv[2];
+
+    char  *words;
+    char  *word;
+    char **argv;
+
+    /* Every word can take at most one slot, plus the problem and NULL. */
+    words = malloc(strlen(command) + 1);
+    argv  = malloc((strlen(command) + 2) * sizeof(char *));
+
+    if ((words == NULL) || (argv == NULL)
+        || (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sv) != 0)) {
+
+        free(words);
+        free(argv);
+
+        return -1;
+    }
+
+    strcpy(words, command);
+
+    for (word = strtok(words, " "); word != NULL; word = strtok(NULL, " ")) {
+        argv[nargs++] = word;
+    }
+
+    argv[nargs++] = (char *) problem;
+    argv[nargs]   = NULL;
+
+    if ((*pid = fork()) == 0) {
+        /* The duplicates lose the close-on-exec flag. */
+        dup2(sv[1], STDIN_FILENO);
+        dup2(sv[1], STDOUT_FILENO);
+
+        execvp(argv[0], argv);
+
+        _exit(EXIT_FAILURE);
+    }
+
+    free(words);
+    free(argv);
+
+    close(sv[1]);
+
+    if (*pid < 0) {
+        close(sv[0]);
+
+        return -1;
+    }
+
+    return sv[0];
+}
+
+/* Sends a request to a worker. */
+int eval_send_request(const int fd,
+                      const uint32_t tag,
+                      const double *x,
+                      const unsigned int n,
+                      const unsigned int m,
+                      char **frame,
+                      size_t *frame_size) {
+
+    unsigned int i;
+
+    struct eval_request request;
+
+    size_t size = sizeof(request) + (size_t) n * sizeof(double);
+
+    char *grown;
+
+    if (*frame_size < size) {
+        if ((grown = realloc(*frame, size)) == NULL) {
+            return 0;
+        }
+
+        *frame      = grown;
+        *frame_size = size;
+    }
+
+    request.tag = tag;
+    request.n   = n;
+
+    memcpy(*frame, &request, sizeof(request));
+
+    for (i = 0; i < n; i++) {
+        memcpy(*frame + sizeof(request) + i * sizeof(double),
+               &x[(size_t) i * m], sizeof(double));
+    }
+
+    return send_full(fd, *frame, size);
+}
+
+/* Receives a reply from a worker. */
+int eval_receive_reply(const int fd, struct eval_reply *reply) {
+    return (read_full(fd, (char *) reply, sizeof(*reply))
+            && (reply->status == EVAL_OK));
+}
+
+/* Serves the requests of the standard input. */
+int eval_serve(const eval_function f,
+               void *data,
+               const unsigned int min,
+               const unsigned int max,
+               const unsigned int delay) {
+
+    int ok;
+
+    size_t size = 0;
+
+    double *x = NULL;
+    double *grown;
+
+    struct eval_request request;
+    struct eval_reply   reply;
+
+    while (read_full(STDIN_FILENO, (char *) &request, sizeof(request))) {
+        if (size < request.n) {
+            if ((grown = realloc(x, request.n * sizeof(double))) == NULL) {
+                free(x);
+
+                return EXIT_FAILURE;
+            }
+
+            x    = grown;
+            size = request.n;
+        }
+
+        if ((request.n > 0)
+            && !read_full(STDIN_FILENO, (char *) x,
+                          request.n * sizeof(double))) {
+
+            break;
+        }
+
+        ok = (request.n >= min) && (request.n <= max) && (request.n > 0);
+
+        reply.tag    = request.tag;
+        reply.status = ok ? EVAL_OK : EVAL_BAD_REQUEST;
+        reply.f      = ok ? f(x, request.n, data) : 0;
+
+        if (delay > 0) {
+            usleep(delay);
+        }
+
+        if (!write_full(STDOUT_FILENO, (const char *) &reply,
+                        sizeof(reply))) {
+
+            break;
+        }
+    }
+
+    free(x);
+
+    return EXIT_SUCCESS;
+}
+
+/* vim:set nu et ts=4 sw=4: */
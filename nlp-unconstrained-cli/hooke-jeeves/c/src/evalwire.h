@@ -0,0 +1,168 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/c/src/evalwire.h
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+/**
+ * The <code>evalwire.h</code> header file declares the protocol
+ * of the evaluation workers: the objective function evaluated
+ * out of process by long-lived worker processes.
+ * <br />
+ * <br />A worker reads the requests from its standard input and writes
+ * the replies to its standard output, both ends of one Unix stream
+ * socket. A request is a <code>struct eval_request</code> followed
+ * by its n coordinates, a reply is a <code>struct eval_reply</code>;
+ * all the fields are in the byte order of the machine (the workers
+ * are local). A worker answers its requests in order, one by one,
+ * and exits at the end of its input. The problem to evaluate is the last
+ * argument of the worker command.
+ * <br />
+ * <br />Both ends are here: the pool side (starting a worker, sending
+ * the requests, receiving the replies) and the worker side (serving
+ * the requests). The C++ tree (<code>EvalPool</code>,
+ * <code>hooke-evalworker</code>) and the Nelder-Mead C tree build
+ * this very module, so the workers of either tree serve both.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @since   hooke-jeeves 0.1
+ */
+
+#ifndef __C__EVALWIRE_H
+#define __C__EVALWIRE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <sys/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Constants. The reply status codes. */
+#define EVAL_OK          0
+#define EVAL_BAD_REQUEST 1
+
+/** The fixed part of a request (8 bytes); the coordinates follow it. */
+struct eval_request {
+    /** The tag the reply carries back. */
+    uint32_t tag;
+
+    /** The number of coordinates. */
+    uint32_t n;
+};
+
+/** A reply (16 bytes, no padding). */
+struct eval_reply {
+    /** The tag of the request. */
+    uint32_t tag;
+
+    /** The status (<code>EVAL_OK</code> or <code>EVAL_BAD_REQUEST</code>). */
+    uint32_t status;
+
+    /** The objective function value. */
+    double f;
+};
+
+/**
+ * The objective function a worker serves.
+ *
+ * @param x    The point.
+ * @param n    The number of coordinates of <code>x</code>.
+ * @param data The data the function was handed over with.
+ *
+ * @return The objective function value.
+ */
+typedef double (*eval_function)(const double *, const unsigned int, void *);
+
+/**
+ * Starts a worker: the words of the command (split at the spaces),
+ * then the problem name.
+ *
+ * @param command The worker command.
+ * @param problem The problem name.
+ * @param pid     The process id (output).
+ *
+ * @return The socket to the worker, or -1 if it has not started.
+ */
+extern int eval_spawn(const char *, const char *, pid_t *);
+
+/**
+ * Sends a request to a worker.
+ *
+ * @param fd         The socket to the worker.
+ * @param tag        The tag of the request.
+ * @param x          The point (coordinate i at <code>x[i * m]</code>).
+ * @param n          The number of coordinates of the point.
+ * @param m          The stride of the coordinates.
+ * @param frame      The request frame (built in place, grown
+ *                   with <code>realloc()</code> as needed).
+ * @param frame_size The size of the request frame.
+ *
+ * @return 0 if the worker has gone away (or there is no memory).
+ */
+extern int eval_send_request(const int,
+                             const uint32_t,
+                             const double *,
+                             const unsigned int,
+                             const unsigned int,
+                             char **,
+                             size_t *);
+
+/**
+ * Receives a reply from a worker.
+ *
+ * @param fd    The socket to the worker.
+ * @param reply The reply (output).
+ *
+ * @return 0 if the worker has gone away or has not evaluated
+ *         the request.
+ */
+extern int eval_receive_reply(const int, struct eval_reply *);
+
+/**
+ * Serves the requests of the standard input (the worker side)
+ * until its end.
+ *
+ * @param f     The objective function.
+ * @param data  The data to hand over to <code>f</code>.
+ * @param min   The fewest coordinates <code>f</code> takes (at least 1).
+ * @param max   The most coordinates <code>f</code> takes (a request
+ *              of another number gets <code>EVAL_BAD_REQUEST</code>).
+ * @param delay The time to sleep per request, in microseconds
+ *              (to stand in for a real simulator).
+ *
+ * @return The exit status.
+ */
+extern int eval_serve(const eval_function,
+                      void *,
+                      const unsigned int,
+                      const unsigned int,
+                      const unsigned int);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __C__EVALWIRE_H */
+
+/* vim:set nu et ts=4 sw=4: */
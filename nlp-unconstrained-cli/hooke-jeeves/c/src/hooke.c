@@ -21,7 +21,11 @@
  * (See the LICENSE file at the top of the source tree.)
  */
 
+#include <string.h>
+
 #include "funevals.h"
+#include "libhooke.h"
+#include "procpool.h"
 
 #ifndef WOODS
     #include "rosenbrock.h"
@@ -29,59 +33,38 @@
     #include "woods.h"
 #endif
 
-/* Helper function best_nearby(...). */
-double best_nearby(double *delta,
-                   double *point,
-                   const double prevbest,
-                   const unsigned int nvars,
-                   void *__fun_evals) {
-
-    double minf;
-    double z[VARS];
-    double ftmp;
-
-    unsigned int i;
-
-    minf = prevbest;
+/* The binary trace (if any) the iteration records go to. */
+static struct bin_trace *bin_trace = NULL;
 
-    for (i = 0; i < nvars; i++) {
-        z[i] = point[i];
-    }
-
-    for (i = 0; i < nvars; i++) {
-        z[i] = point[i] + delta[i];
+/* Setter for the binary trace. */
+void set_bin_trace(struct bin_trace *__bin_trace) {
+    bin_trace = __bin_trace;
+}
 
-#ifndef WOODS
-        ftmp = f(z, nvars, __fun_evals);
-#else
-        ftmp = f(z, nvars, __fun_evals);
-#endif
+/*
+ * Helper function trace(...).
+ * The iteration callback: writes the state at the start of an iteration
+ * into the binary trace (if any) or else prints it.
+ */
+static void trace(const unsigned int iters,
+                  const unsigned long funevals,
+                  const double fx,
+                  const double *x,
+                  const unsigned int nvars,
+                  void *__bin_trace) {
 
-        if (ftmp < minf) {
-            minf = ftmp;
-        } else {
-            delta[i] = 0.0 - delta[i];
-            z[i]     = point[i] + delta[i];
+    unsigned int j;
 
-#ifndef WOODS
-            ftmp = f(z, nvars, __fun_evals);
-#else
-            ftmp = f(z, nvars, __fun_evals);
-#endif
+    if (__bin_trace != NULL) {
+        bin_trace_record(__bin_trace, BIN_TRACE_ITERATION, iters, funevals,
+                         fx, x);
+    } else {
+        printf("\nAfter %5lu funevals, f(x) =  %.4le at\n", funevals, fx);
 
-            if (ftmp < minf) {
-                minf = ftmp;
-            } else {
-                z[i] = point[i];
-            }
+        for (j = 0; j < nvars; j++) {
+            printf("   x[%2d] = %.4le\n", j, x[j]);
         }
     }
-
-    for (i = 0; i < nvars; i++) {
-        point[i] = z[i];
-    }
-
-    return minf;
 }
 
 /* Main optimization function hooke(...). */
@@ -92,147 +75,137 @@ unsigned int hooke(const unsigned int nvars,
                    const double epsilon,
                    const unsigned int itermax) {
 
-    unsigned int i;
-    unsigned int iadj;
     unsigned int iters;
-    unsigned int j;
-    unsigned int keep;
 
-    double newx[VARS];
-    double xbefore[VARS];
-    double delta[VARS];
-    double steplength;
-    double fbefore;
-    double newf;
-    double tmp;
+    /* The workspace of the solve (on the stack, as the vectors were). */
+    double workspace[HOOKE_WORKSPACE_VECTORS * VARS];
 
-    struct fun_evals *fe;
-
-    for (i = 0; i < nvars; i++) {
-        newx[i] = xbefore[i] = startpt[i];
+    /* The evaluations counter the objective function keeps. */
+    struct fun_evals fe = {0};
 
-        delta[i] = fabs(startpt[i] * rho);
+    /* The solve itself is the one of the library, plus the trace. */
+    struct hooke_solver *solver = hooke_solver_new(f, &fe);
 
-        if (delta[i] == 0.0) {
-            delta[i] = rho;
-        }
+    if (solver == NULL) {
+        return 0;
     }
 
-    iadj       = 0;
-    steplength = rho;
-    iters      = 0;
+    hooke_solver_set_trace(solver, trace, bin_trace);
 
-    /* Allocating memory for the fun_evals structure. */
-    fe = malloc(sizeof(*fe));
+    hooke_solve(solver, nvars, startpt, endpt, rho, epsilon, itermax,
+                workspace, hooke_workspace_size(nvars));
 
-#ifndef WOODS
-    fbefore = f(newx, nvars, fe);
-#else
-    fbefore = f(newx, nvars, fe);
-#endif
+    iters = hooke_solver_iters(solver);
 
-    newf = fbefore;
+    hooke_solver_free(solver);
 
-    while ((iters < itermax) && (steplength > epsilon)) {
-        iters++;
-        iadj++;
+    return iters;
+}
 
-        printf(
-            "\nAfter %5d funevals, f(x) =  %.4le at\n",
-            get_funevals(fe), fbefore
-        );
+/*
+ * Helper function multi_start(...).
+ * Runs the multi-start mode: the default starting guess plus
+ * nstarts - 1 points drawn uniformly from a box around it, all solved
+ * on a pool of worker processes, and prints the results.
+ */
+static int multi_start(const unsigned int nvars,
+                       const double *startpt,
+                       const double rho,
+                       const double epsilon,
+                       const unsigned int itermax,
+                       const unsigned int nstarts,
+                       const unsigned int workers) {
 
-        for (j = 0; j < nvars; j++) {
-            printf("   x[%2d] = %.4le\n", j, xbefore[j]);
-        }
+    unsigned int i;
+    unsigned int k;
+    unsigned int best;
 
-        /* Find best new point, one coord at a time. */
-        for (i = 0; i < nvars; i++) {
-            newx[i] = xbefore[i];
-        }
+    double *startpts = malloc((size_t) nstarts * nvars * sizeof(double));
 
-        newf = best_nearby(delta, newx, fbefore, nvars, fe);
+    /* Every worker counts its evaluations in its own copy of it. */
+    struct fun_evals fe = {0};
 
-        /* If we made some improvements, pursue that direction. */
-        keep = 1;
+    struct proc_pool *pool;
 
-        while ((newf < fbefore) && (keep == 1)) {
-            iadj = 0;
+    if (startpts == NULL) {
+        return EXIT_FAILURE;
+    }
 
-            for (i = 0; i < nvars; i++) {
-                /* Firstly, arrange the sign of delta[]. */
-                if (newx[i] <= xbefore[i]) {
-                    delta[i] = 0.0 - fabs(delta[i]);
-                } else {
-                    delta[i] = fabs(delta[i]);
-                }
+    /* The first start is the default starting guess itself. */
+    for (i = 0; i < nvars; i++) {
+        startpts[i] = startpt[i];
+    }
 
-                /* Now, move further in this direction. */
-                tmp        = xbefore[i];
-                xbefore[i] = newx[i];
-                newx[i]    = newx[i] + newx[i] - tmp;
-            }
+    srand(MULTISTART_SEED);
 
-            fbefore = newf;
+    for (k = 1; k < nstarts; k++) {
+        for (i = 0; i < nvars; i++) {
+            startpts[k * nvars + i] = startpt[i] + MULTISTART_SPREAD
+                * (TWO * ((double) rand() / RAND_MAX) - ONE_POINT_ZERO);
+        }
+    }
 
-            newf = best_nearby(delta, newx, fbefore, nvars, fe);
+    pool = proc_pool_new(nstarts, nvars, startpts);
 
-            /* If the further (optimistic) move was bad.... */
-            if (newf >= fbefore) {
-                break;
-            }
+    free(startpts);
 
-            /*
-             * Make sure that the differences between the new and the old
-             * points are due to actual displacements; beware of roundoff
-             * errors that might cause newf < fbefore.
-             */
-            keep = 0;
+    if (pool == NULL) {
+        return EXIT_FAILURE;
+    }
 
-            for (i = 0; i < nvars; i++) {
-                keep = 1;
+    best = proc_pool_multi_start(pool, workers, f, &fe, rho, epsilon,
+                                 itermax);
 
-                if (fabs(newx[i] - xbefore[i])
-                    > (ZERO_POINT_FIVE * fabs(delta[i]))) {
+    printf("\nMULTI-START: %u STARTS ON %u WORKERS\n", nstarts,
+           pool->workers);
 
-                    break;
-                } else {
-                    keep = 0;
-                }
-            }
+    for (k = 0; k < nstarts; k++) {
+        if (pool->done[k]) {
+            printf("start[%5u]: %5u iterations, %7lu funevals, "
+                   "f(x) = %15.7le\n", k, pool->iters[k],
+                   pool->funevals[k], pool->fend[k]);
+        } else {
+            printf("start[%5u]: failed\n", k);
         }
+    }
 
-        if ((steplength >= epsilon) && (newf >= fbefore)) {
-            steplength = steplength * rho;
+    if (best == nstarts) {
+        proc_pool_free(pool);
 
-            for (i = 0; i < nvars; i++) {
-                delta[i] *= rho;
-            }
-        }
+        return EXIT_FAILURE;
     }
 
+    printf("\n\n\nBEST OF %u STARTS IS start[%u], HOOKE USED %u "
+           "ITERATIONS, AND RETURNED\n", nstarts, best, pool->iters[best]);
+
     for (i = 0; i < nvars; i++) {
-        endpt[i] = xbefore[i];
+        printf("x[%3d] = %15.7le \n", i, pool->endpts[best * nvars + i]);
     }
 
-    /* Releasing memory, allocated for the fun_evals structure. */
-    free(fe);
+    proc_pool_free(pool);
 
-    return iters;
+    return EXIT_SUCCESS;
 }
 
 /* Main program function main() :-). */
-int main(void) {
+int main(int argc, char **argv) {
+    int arg;
+
     unsigned int nvars;
     unsigned int itermax;
     unsigned int jj;
     unsigned int i;
+    unsigned int nstarts = 0;
+    unsigned int workers = 0;
 
     double startpt[VARS];
     double rho;
     double epsilon;
     double endpt[VARS];
 
+    const char       *trace_path = NULL;
+    struct bin_trace *trace      = NULL;
+
 #ifndef WOODS
     /* Starting guess for Rosenbrock's test function. */
     nvars                = TWO;
@@ -252,8 +225,63 @@ int main(void) {
     itermax = IMAX;
     epsilon = EPSMIN;
 
+    /*
+     * The options: the binary trace file (instead of the text one),
+     * or else the multi-start mode (on a pool of worker processes).
+     */
+    for (arg = 1; arg < argc; arg++) {
+        if (strncmp(argv[arg], TRACE_BIN_OPTION,
+                    strlen(TRACE_BIN_OPTION)) == 0) {
+
+            trace_path = argv[arg] + strlen(TRACE_BIN_OPTION);
+        } else if ((strncmp(argv[arg], STARTS_OPTION,
+                            strlen(STARTS_OPTION)) == 0)
+                   && (atoi(argv[arg] + strlen(STARTS_OPTION)) > 0)) {
+
+            nstarts = atoi(argv[arg] + strlen(STARTS_OPTION));
+        } else if ((strncmp(argv[arg], WORKERS_OPTION,
+                            strlen(WORKERS_OPTION)) == 0)
+                   && (atoi(argv[arg] + strlen(WORKERS_OPTION)) >= 0)) {
+
+            workers = atoi(argv[arg] + strlen(WORKERS_OPTION));
+        } else {
+            break;
+        }
+    }
+
+    if ((arg < argc) || ((trace_path != NULL) && (nstarts > 0))) {
+        fprintf(stderr, "Usage: %s [%sPATH | %sK [%sN]]\n", argv[0],
+                TRACE_BIN_OPTION, STARTS_OPTION, WORKERS_OPTION);
+
+        return EXIT_FAILURE;
+    }
+
+    if (nstarts > 0) {
+        return multi_start(nvars, startpt, rho, epsilon, itermax, nstarts,
+                           workers);
+    }
+
+    if (trace_path != NULL) {
+        trace = bin_trace_open(trace_path, BIN_TRACE_HOOKE, nvars, rho,
+                               epsilon);
+
+        if (trace == NULL) {
+            fprintf(stderr, "%s: cannot open %s\n", argv[0], trace_path);
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    set_bin_trace(trace);
+
     jj = hooke(nvars, startpt, endpt, rho, epsilon, itermax);
 
+    if ((trace != NULL) && (bin_trace_close(trace) != 0)) {
+        fprintf(stderr, "%s: cannot write %s\n", argv[0], trace_path);
+
+        return EXIT_FAILURE;
+    }
+
     printf("\n\n\nHOOKE USED %d ITERATIONS, AND RETURNED\n", jj);
 
     for (i = 0; i < nvars; i++) {
@@ -38,6 +38,8 @@
 #include <stdio.h>
 #include <math.h>
 
+#include "bintrace.h"
+
 /** Constant. The maximum number of variables. */
 #define VARS 250
 
@@ -61,6 +63,9 @@
 /** Constant. The maximum number of iterations. */
 #define IMAX 5000
 
+/** Constant. The binary trace command-line option (followed by a path). */
+#define TRACE_BIN_OPTION "--trace-bin="
+
 /** Helper constants. */
 #define INDEX_ZERO           0
 #define INDEX_ONE            1
@@ -72,32 +77,23 @@
 #define ONE_POINT_ZERO       1.0
 #define MINUS_THREE         -3
 #define MINUS_ONE           -1
-#define ZERO_POINT_FIVE      0.5
 
 /**
- * Helper function.
+ * Setter for the binary trace.
  * <br />
- * <br />Given a point, look for a better one nearby, one coord at a time.
- *
- * @param delta       The delta between <code>prevbest</code>
- *                    and <code>point</code>.
- * @param point       The coordinate from where to begin.
- * @param prevbest    The previous best-valued coordinate.
- * @param nvars       The number of variables.
- * @param __fun_evals The number of function evaluations container (struct *).
+ * <br />When set, <code>hooke()</code> writes its iteration records
+ * into the binary trace instead of printing them.
  *
- * @return The objective function value at a nearby.
+ * @param __bin_trace The binary trace (struct *), or <code>NULL</code>
+ *                    for the text one.
  */
-extern double best_nearby(double *,
-                          double *,
-                          const double,
-                          const unsigned int,
-                          void *);
+extern void set_bin_trace(struct bin_trace *);
 
 /**
  * Main optimization function.
  * <br />
- * <br />The hooke subroutine itself.
+ * <br />The hooke subroutine itself (the solve of the library,
+ * with the iteration trace).
  *
  * @param nvars   The number of variables.
  * @param startpt The starting point coordinates.
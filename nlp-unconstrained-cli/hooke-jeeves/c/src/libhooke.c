@@ -0,0 +1,325 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/c/src/libhooke.c
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#include <stdlib.h>
+#include <math.h>
+
+#include "libhooke.h"
+
+/* Helper constant. */
+#define ZERO_POINT_FIVE 0.5
+
+/* The solver (the callbacks and the counts of the last solve). */
+struct hooke_solver {
+    /* The objective function. */
+    hooke_objective objective;
+
+    /* The pointer passed to every call of the objective function. */
+    void *user_data;
+
+    /* The iteration callback (if any). */
+    hooke_iteration iteration;
+
+    /* The pointer passed to every call of the iteration callback. */
+    void *trace_data;
+
+    /* The number of iterations of the last solve. */
+    unsigned int iters;
+
+    /* The number of function evaluations of the last solve. */
+    unsigned long funevals;
+
+    /* The objective function value at the ending point of the last solve. */
+    double f;
+};
+
+/*
+ * Helper function.
+ * Evaluates the objective function, counting the evaluation.
+ */
+static double eval(struct hooke_solver *solver,
+                   const double *x,
+                   const unsigned int nvars) {
+
+    solver->funevals++;
+
+    return solver->objective(x, nvars, solver->user_data);
+}
+
+/*
+ * Helper function best_nearby(...).
+ * Given a point, look for a better one nearby, one coord at a time
+ * (z is the scratch point of the workspace).
+ */
+static double best_nearby(struct hooke_solver *solver,
+                          double *delta,
+                          double *point,
+                          double *z,
+                          const double prevbest,
+                          const unsigned int nvars) {
+
+    double minf;
+    double ftmp;
+
+    unsigned int i;
+
+    minf = prevbest;
+
+    for (i = 0; i < nvars; i++) {
+        z[i] = point[i];
+    }
+
+    for (i = 0; i < nvars; i++) {
+        z[i] = point[i] + delta[i];
+
+        ftmp = eval(solver, z, nvars);
+
+        if (ftmp < minf) {
+            minf = ftmp;
+        } else {
+            delta[i] = 0.0 - delta[i];
+            z[i]     = point[i] + delta[i];
+
+            ftmp = eval(solver, z, nvars);
+
+            if (ftmp < minf) {
+                minf = ftmp;
+            } else {
+                z[i] = point[i];
+            }
+        }
+    }
+
+    for (i = 0; i < nvars; i++) {
+        point[i] = z[i];
+    }
+
+    return minf;
+}
+
+/* Getter for the ABI version. */
+unsigned int hooke_abi_version(void) {
+    return HOOKE_ABI_VERSION;
+}
+
+/* Constructor. */
+struct hooke_solver *hooke_solver_new(hooke_objective __objective,
+                                      void *__user_data) {
+
+    struct hooke_solver *solver;
+
+    if (__objective == NULL) {
+        return NULL;
+    }
+
+    if ((solver = malloc(sizeof(*solver))) == NULL) {
+        return NULL;
+    }
+
+    solver->objective  = __objective;
+    solver->user_data  = __user_data;
+    solver->iteration  = NULL;
+    solver->trace_data = NULL;
+    solver->iters      = 0;
+    solver->funevals   = 0;
+    solver->f          = 0.0;
+
+    return solver;
+}
+
+/* Destructor. */
+void hooke_solver_free(struct hooke_solver *solver) {
+    free(solver);
+}
+
+/* Setter for the iteration callback. */
+void hooke_solver_set_trace(struct hooke_solver *solver,
+                            hooke_iteration __iteration,
+                            void *__trace_data) {
+
+    solver->iteration  = __iteration;
+    solver->trace_data = __trace_data;
+}
+
+/* Getter for the size of the workspace of a solve. */
+size_t hooke_workspace_size(const unsigned int nvars) {
+    return (size_t) HOOKE_WORKSPACE_VECTORS * nvars;
+}
+
+/* Main optimization function hooke_solve(...). */
+int hooke_solve(struct hooke_solver *solver,
+                const unsigned int nvars,
+                const double *startpt,
+                double *endpt,
+                const double rho,
+                const double epsilon,
+                const unsigned int itermax,
+                double *workspace,
+                const size_t size) {
+
+    unsigned int i;
+    unsigned int iters;
+    unsigned int keep;
+
+    double *newx;
+    double *xbefore;
+    double *delta;
+    double *z;
+    double steplength;
+    double fbefore;
+    double newf;
+    double tmp;
+
+    if ((solver == NULL) || (nvars == 0) || (startpt == NULL)
+        || (endpt == NULL) || !(rho > 0.0) || !(rho < 1.0)
+        || (workspace == NULL)) {
+
+        return HOOKE_ERROR_ARGUMENT;
+    }
+
+    if (size < hooke_workspace_size(nvars)) {
+        return HOOKE_ERROR_WORKSPACE;
+    }
+
+    /* The workspace: the vectors of the solve, one after another. */
+    newx    = workspace;
+    xbefore = newx    + nvars;
+    delta   = xbefore + nvars;
+    z       = delta   + nvars;
+
+    for (i = 0; i < nvars; i++) {
+        newx[i] = xbefore[i] = startpt[i];
+
+        delta[i] = fabs(startpt[i] * rho);
+
+        if (delta[i] == 0.0) {
+            delta[i] = rho;
+        }
+    }
+
+    steplength = rho;
+    iters      = 0;
+
+    solver->funevals = 0;
+
+    fbefore = eval(solver, newx, nvars);
+
+    newf = fbefore;
+
+    while ((iters < itermax) && (steplength > epsilon)) {
+        iters++;
+
+        if (solver->iteration != NULL) {
+            solver->iteration(iters, solver->funevals, fbefore, xbefore,
+                              nvars, solver->trace_data);
+        }
+
+        /* Find best new point, one coord at a time. */
+        for (i = 0; i < nvars; i++) {
+            newx[i] = xbefore[i];
+        }
+
+        newf = best_nearby(solver, delta, newx, z, fbefore, nvars);
+
+        /* If we made some improvements, pursue that direction. */
+        keep = 1;
+
+        while ((newf < fbefore) && (keep == 1)) {
+            for (i = 0; i < nvars; i++) {
+                /* Firstly, arrange the sign of delta[]. */
+                if (newx[i] <= xbefore[i]) {
+                    delta[i] = 0.0 - fabs(delta[i]);
+                } else {
+                    delta[i] = fabs(delta[i]);
+                }
+
+                /* Now, move further in this direction. */
+                tmp        = xbefore[i];
+                xbefore[i] = newx[i];
+                newx[i]    = newx[i] + newx[i] - tmp;
+            }
+
+            fbefore = newf;
+
+            newf = best_nearby(solver, delta, newx, z, fbefore, nvars);
+
+            /* If the further (optimistic) move was bad.... */
+            if (newf >= fbefore) {
+                break;
+            }
+
+            /*
+             * Make sure that the differences between the new and the old
+             * points are due to actual displacements; beware of roundoff
+             * errors that might cause newf < fbefore.
+             */
+            keep = 0;
+
+            for (i = 0; i < nvars; i++) {
+                keep = 1;
+
+                if (fabs(newx[i] - xbefore[i])
+                    > (ZERO_POINT_FIVE * fabs(delta[i]))) {
+
+                    break;
+                } else {
+                    keep = 0;
+                }
+            }
+        }
+
+        if ((steplength >= epsilon) && (newf >= fbefore)) {
+            steplength = steplength * rho;
+
+            for (i = 0; i < nvars; i++) {
+                delta[i] *= rho;
+            }
+        }
+    }
+
+    for (i = 0; i < nvars; i++) {
+        endpt[i] = xbefore[i];
+    }
+
+    solver->iters = iters;
+    solver->f     = fbefore;
+
+    return HOOKE_OK;
+}
+
+/* Getter for the number of iterations of the last solve. */
+unsigned int hooke_solver_iters(const struct hooke_solver *solver) {
+    return solver->iters;
+}
+
+/* Getter for the number of function evaluations of the last solve. */
+unsigned long hooke_solver_funevals(const struct hooke_solver *solver) {
+    return solver->funevals;
+}
+
+/* Getter for the objective function value at the ending point. */
+double hooke_solver_f(const struct hooke_solver *solver) {
+    return solver->f;
+}
+
+/* vim:set nu et ts=4 sw=4: */
@@ -0,0 +1,224 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/c/src/libhooke.h
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+/**
+ * The <code>libhooke.h</code> header file is the public interface
+ * of the Hooke and Jeeves solver library (<code>libhooke.a</code>
+ * and <code>libhooke.so</code>).
+ * <br />
+ * <br />The solver is an opaque handle holding the objective function
+ * (a callback plus a user-data pointer passed back to it), an optional
+ * iteration callback (the trace) and the counts of the last solve.
+ * The scratch vectors of a solve are a workspace the caller owns,
+ * so that a solve allocates nothing and does no I/O of its own.
+ * Solves on different handles (and workspaces) may run concurrently.
+ * <br />
+ * <br />Only this header is public: the layout of the handle may change
+ * without the ABI version changing, the functions below may not.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @since   hooke-jeeves 0.1
+ */
+
+#ifndef __C__LIBHOOKE_H
+#define __C__LIBHOOKE_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Constant. The ABI version (the one in the shared library soname). */
+#define HOOKE_ABI_VERSION 1
+
+/** Constant. The number of the workspace doubles needed per variable. */
+#define HOOKE_WORKSPACE_VECTORS 4
+
+/** Constants. The status codes <code>hooke_solve()</code> returns. */
+#define HOOKE_OK              0
+#define HOOKE_ERROR_ARGUMENT  1
+#define HOOKE_ERROR_WORKSPACE 2
+
+/** Constant. The attribute the library exports its functions with. */
+#if defined(__GNUC__) && (__GNUC__ >= 4)
+    #define HOOKE_API __attribute__((visibility("default")))
+#else
+    #define HOOKE_API
+#endif
+
+/** The solver (opaque). */
+struct hooke_solver;
+
+/**
+ * The objective function.
+ *
+ * @param x         The point at which f(x) should be evaluated.
+ * @param n         The number of coordinates of <code>x</code>.
+ * @param user_data The user-data pointer the solver has been given.
+ *
+ * @return The objective function value.
+ */
+typedef double (*hooke_objective)(const double *, const unsigned int, void *);
+
+/**
+ * The iteration callback: it gets the state at the start
+ * of every iteration.
+ *
+ * @param iters      The iteration number.
+ * @param funevals   The number of function evaluations so far.
+ * @param fx         The objective function value at the point.
+ * @param x          The point.
+ * @param n          The number of coordinates of <code>x</code>.
+ * @param trace_data The trace-data pointer the solver has been given.
+ */
+typedef void (*hooke_iteration)(const unsigned int,
+                                const unsigned long,
+                                const double,
+                                const double *,
+                                const unsigned int,
+                                void *);
+
+/**
+ * Getter for the ABI version of the library linked in
+ * (to be checked against <code>HOOKE_ABI_VERSION</code>).
+ *
+ * @return The ABI version.
+ */
+extern HOOKE_API unsigned int hooke_abi_version(void);
+
+/**
+ * Constructor.
+ * <br />
+ * <br />Allocates a solver (the only allocation the library makes).
+ *
+ * @param objective The objective function.
+ * @param user_data The pointer passed to every call of the objective
+ *                  function (may be <code>NULL</code>).
+ *
+ * @return The solver, or <code>NULL</code> if the objective function
+ *         is <code>NULL</code> or the solver cannot be allocated.
+ */
+extern HOOKE_API struct hooke_solver *hooke_solver_new(hooke_objective,
+                                                       void *);
+
+/**
+ * Destructor.
+ *
+ * @param solver The solver (may be <code>NULL</code>).
+ */
+extern HOOKE_API void hooke_solver_free(struct hooke_solver *);
+
+/**
+ * Setter for the iteration callback.
+ *
+ * @param solver     The solver.
+ * @param iteration  The iteration callback (<code>NULL</code> for none,
+ *                   the default).
+ * @param trace_data The pointer passed to every call of the iteration
+ *                   callback (may be <code>NULL</code>).
+ */
+extern HOOKE_API void hooke_solver_set_trace(struct hooke_solver *,
+                                             hooke_iteration,
+                                             void *);
+
+/**
+ * Getter for the size of the workspace of a solve.
+ *
+ * @param nvars The number of variables.
+ *
+ * @return The number of doubles the workspace has to have.
+ */
+extern HOOKE_API size_t hooke_workspace_size(const unsigned int);
+
+/**
+ * Main optimization function.
+ * <br />
+ * <br />Solves the problem from a starting point; the <code>hooke</code>
+ * executable does its solve through it, with its trace as the iteration
+ * callback.
+ *
+ * @param solver    The solver.
+ * @param nvars     The number of variables.
+ * @param startpt   The starting point coordinates.
+ * @param endpt     The ending point coordinates.
+ * @param rho       The rho value.
+ * @param epsilon   The epsilon value.
+ * @param itermax   The maximum number of iterations.
+ * @param workspace The workspace.
+ * @param size      The number of doubles of the workspace
+ *                  (at least <code>hooke_workspace_size(nvars)</code>).
+ *
+ * @return <code>HOOKE_OK</code>, <code>HOOKE_ERROR_ARGUMENT</code>
+ *         if an argument is out of its domain (a <code>NULL</code>
+ *         pointer, no variables, rho not in (0, 1))
+ *         or <code>HOOKE_ERROR_WORKSPACE</code> if the workspace
+ *         is too small.
+ */
+extern HOOKE_API int hooke_solve(struct hooke_solver *,
+                                 const unsigned int,
+                                 const double *,
+                                 double *,
+                                 const double,
+                                 const double,
+                                 const unsigned int,
+                                 double *,
+                                 const size_t);
+
+/**
+ * Getter for the number of iterations of the last solve.
+ *
+ * @param solver The solver.
+ *
+ * @return The number of iterations used to find the local minimum.
+ */
+extern HOOKE_API unsigned int hooke_solver_iters(const struct hooke_solver *);
+
+/**
+ * Getter for the number of function evaluations of the last solve.
+ *
+ * @param solver The solver.
+ *
+ * @return The number of function evaluations.
+ */
+extern HOOKE_API unsigned long hooke_solver_funevals(
+    const struct hooke_solver *);
+
+/**
+ * Getter for the objective function value at the ending point
+ * of the last solve.
+ *
+ * @param solver The solver.
+ *
+ * @return The objective function value.
+ */
+extern HOOKE_API double hooke_solver_f(const struct hooke_solver *);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __C__LIBHOOKE_H */
+
+/* vim:set nu et ts=4 sw=4: */
@@ -0,0 +1,226 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/c/src/procpool.c
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+/* For mmap(MAP_ANONYMOUS) and sysconf() (not in the C standard). */
+#define _DEFAULT_SOURCE
+
+#include <errno.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "procpool.h"
+
+/* Helper function. Rounds a size up to a multiple of a double. */
+static size_t align_double(const size_t size) {
+    return (size + sizeof(double) - 1) / sizeof(double) * sizeof(double);
+}
+
+/* Constructor. */
+struct proc_pool *proc_pool_new(const unsigned int nstarts,
+                                const unsigned int nvars,
+                                const double *startpts) {
+
+    size_t head   = align_double(sizeof(struct proc_pool));
+    size_t points = (size_t) nstarts * nvars * sizeof(double);
+    size_t size   = head + points + points + nstarts * sizeof(double)
+                  + nstarts * sizeof(unsigned long)
+                  + (size_t) 2 * nstarts * sizeof(unsigned int)
+                  + nstarts * sizeof(pid_t);
+
+    char *p;
+
+    struct proc_pool *pool;
+
+    if ((nstarts == 0) || (nvars == 0)) {
+        return NULL;
+    }
+
+    /* Anonymous and shared: the workers forked later write into it. */
+    p = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS,
+             -1, 0);
+
+    if (p == MAP_FAILED) {
+        return NULL;
+    }
+
+    pool = (struct proc_pool *) p;
+
+    atomic_init(&pool->next, 0);
+
+    pool->nstarts  = nstarts;
+    pool->nvars    = nvars;
+    pool->workers  = 0;
+    pool->size     = size;
+    pool->startpts = (double *) (p + head);
+    pool->endpts   = pool->startpts + (size_t) nstarts * nvars;
+    pool->fend     = pool->endpts   + (size_t) nstarts * nvars;
+    pool->funevals = (unsigned long *) (pool->fend + nstarts);
+    pool->iters    = (unsigned int *) (pool->funevals + nstarts);
+    pool->done     = pool->iters + nstarts;
+    pool->pids     = (pid_t *) (pool->done + nstarts);
+
+    memcpy(pool->startpts, startpts, points);
+
+    return pool;
+}
+
+/* Destructor. */
+void proc_pool_free(struct proc_pool *pool) {
+    if (pool != NULL) {
+        munmap(pool, pool->size);
+    }
+}
+
+/*
+ * Helper function.
+ * The worker process body: solves the starts it pulls off the counter
+ * until there are none left. The solver and its workspace are set up
+ * once, so the solves themselves allocate nothing.
+ */
+static void worker(struct proc_pool *pool,
+                   hooke_objective objective,
+                   void *user_data,
+                   const double rho,
+                   const double epsilon,
+                   const unsigned int itermax) {
+
+    unsigned int k;
+
+    size_t size = hooke_workspace_size(pool->nvars);
+
+    double *workspace = malloc(size * sizeof(double));
+
+    struct hooke_solver *solver = hooke_solver_new(objective, user_data);
+
+    if ((workspace == NULL) || (solver == NULL)) {
+        hooke_solver_free(solver);
+        free(workspace);
+
+        return;
+    }
+
+    while ((k = atomic_fetch_add(&pool->next, 1)) < pool->nstarts) {
+        double *endpt = pool->endpts + (size_t) k * pool->nvars;
+
+        if (hooke_solve(solver, pool->nvars,
+                        pool->startpts + (size_t) k * pool->nvars, endpt,
+                        rho, epsilon, itermax, workspace, size) != HOOKE_OK) {
+
+            continue;
+        }
+
+        pool->iters[k]    = hooke_solver_iters(solver);
+        pool->funevals[k] = hooke_solver_funevals(solver);
+        pool->fend[k]     = hooke_solver_f(solver);
+        pool->done[k]     = 1;
+    }
+
+    hooke_solver_free(solver);
+    free(workspace);
+}
+
+/* Main driver function proc_pool_multi_start(...). */
+unsigned int proc_pool_multi_start(struct proc_pool *pool,
+                                   const unsigned int workers,
+                                   hooke_objective objective,
+                                   void *user_data,
+                                   const double rho,
+                                   const double epsilon,
+                                   const unsigned int itermax) {
+
+    unsigned int w;
+    unsigned int k;
+    unsigned int best;
+    unsigned int nworkers = workers;
+
+    long online;
+
+    pid_t pid;
+
+    if (nworkers == 0) {
+        online   = sysconf(_SC_NPROCESSORS_ONLN);
+        nworkers = (online > 0) ? online : 1;
+    }
+
+    if (nworkers > pool->nstarts) {
+        nworkers = pool->nstarts;
+    }
+
+    atomic_store(&pool->next, 0);
+
+    pool->workers = 0;
+
+    for (k = 0; k < pool->nstarts; k++) {
+        pool->done[k] = 0;
+    }
+
+    /* Nothing buffered must get written by the workers again. */
+    fflush(stdout);
+
+    for (w = 0; w < nworkers; w++) {
+        if ((pid = fork()) < 0) {
+            break;
+        }
+
+        if (pid == 0) {
+            worker(pool, objective, user_data, rho, epsilon, itermax);
+
+            _exit(EXIT_SUCCESS);
+        }
+
+        pool->pids[pool->workers++] = pid;
+    }
+
+    /*
+     * Waiting for each of the workers to exit (which also makes their
+     * writes into the mapping visible here); should none have been forked,
+     * the starts are solved in this process.
+     */
+    for (w = 0; w < pool->workers; w++) {
+        while ((waitpid(pool->pids[w], NULL, 0) < 0) && (errno == EINTR)) {
+        }
+    }
+
+    if (pool->workers == 0) {
+        worker(pool, objective, user_data, rho, epsilon, itermax);
+    }
+
+    best = pool->nstarts;
+
+    for (k = 0; k < pool->nstarts; k++) {
+        if (pool->done[k] && ((best == pool->nstarts)
+                              || (pool->fend[k] < pool->fend[best]))) {
+
+            best = k;
+        }
+    }
+
+    return best;
+}
+
+/* vim:set nu et ts=4 sw=4: */
@@ -0,0 +1,166 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/c/src/procpool.h
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+/**
+ * The <code>procpool.h</code> header file declares the process pool
+ * multi-start driver: the solves from many starting points spread
+ * across pre-forked worker processes, for the objective functions which
+ * can only run one instance per process (thread-unsafe ones).
+ * <br />
+ * <br />The starting points, the start index counter and the results
+ * live in one shared anonymous mapping set up before the fork: every
+ * worker pulls the next start index off the atomic counter, solves
+ * it (through <code>libhooke</code>, its workspace allocated once)
+ * and writes the ending point and the counts right into the mapping.
+ * Nothing goes through a pipe and nothing is serialized.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @since   hooke-jeeves 0.1
+ */
+
+#ifndef __C__PROCPOOL_H
+#define __C__PROCPOOL_H
+
+#include <stdatomic.h>
+
+#include <sys/types.h>
+
+#include "libhooke.h"
+
+/** Constant. The starts command-line option (followed by a number). */
+#define STARTS_OPTION "--starts="
+
+/** Constant. The workers command-line option (followed by a number). */
+#define WORKERS_OPTION "--workers="
+
+/** Constant. The seed for generating the multi-start points. */
+#define MULTISTART_SEED 566
+
+/**
+ * Constant. The half-width of the box around the default starting guess
+ * the multi-start points are drawn from.
+ */
+#define MULTISTART_SPREAD 2.0
+
+/**
+ * The structure to hold the results of a multi-start run
+ * (the head of the shared mapping, the arrays follow it).
+ */
+struct proc_pool {
+    /** The index of the next start to be pulled by a worker. */
+    atomic_uint next;
+
+    /** The number of starting points. */
+    unsigned int nstarts;
+
+    /** The number of variables. */
+    unsigned int nvars;
+
+    /** The number of the workers forked. */
+    unsigned int workers;
+
+    /** The size of the mapping. */
+    size_t size;
+
+    /** The starting points (<code>nstarts</code> rows of nvars). */
+    double *startpts;
+
+    /** The ending points (the same layout). */
+    double *endpts;
+
+    /** The objective function value at each ending point. */
+    double *fend;
+
+    /** The number of function evaluations per start. */
+    unsigned long *funevals;
+
+    /** The number of iterations per start. */
+    unsigned int *iters;
+
+    /**
+     * Whether each start has been solved (0 if its worker died
+     * or could not set up its solver).
+     */
+    unsigned int *done;
+
+    /** The process ids of the workers forked (at most nstarts). */
+    pid_t *pids;
+};
+
+/**
+ * Constructor.
+ * <br />
+ * <br />Sets up the shared mapping of a multi-start run and copies
+ * the starting points into it.
+ *
+ * @param nstarts  The number of starting points.
+ * @param nvars    The number of variables.
+ * @param startpts The starting points (<code>nstarts</code> rows
+ *                 of <code>nvars</code>).
+ *
+ * @return The run, or <code>NULL</code> if the mapping cannot be set up.
+ */
+extern struct proc_pool *proc_pool_new(const unsigned int,
+                                       const unsigned int,
+                                       const double *);
+
+/**
+ * Destructor (unmaps the shared mapping).
+ *
+ * @param pool The run (may be <code>NULL</code>).
+ */
+extern void proc_pool_free(struct proc_pool *);
+
+/**
+ * Main driver function.
+ * <br />
+ * <br />Forks the workers, lets them solve every start and waits
+ * for them all to exit (only for them: the other children of the caller
+ * are left alone).
+ *
+ * @param pool      The run.
+ * @param workers   The number of workers (0 means one per online CPU;
+ *                  never more than there are starts).
+ * @param objective The objective function.
+ * @param user_data The pointer passed to every call of the objective
+ *                  function (every worker gets its own copy
+ *                  of the memory it points to).
+ * @param rho       The rho value.
+ * @param epsilon   The epsilon value.
+ * @param itermax   The maximum number of iterations.
+ *
+ * @return The index of the solved start that reached the lowest value,
+ *         or <code>nstarts</code> if no start has been solved.
+ */
+extern unsigned int proc_pool_multi_start(struct proc_pool *,
+                                          const unsigned int,
+                                          hooke_objective,
+                                          void *,
+                                          const double,
+                                          const double,
+                                          const unsigned int);
+
+#endif /* __C__PROCPOOL_H */
+
+/* vim:set nu et ts=4 sw=4: */
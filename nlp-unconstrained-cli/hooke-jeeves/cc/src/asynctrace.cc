@@ -0,0 +1,215 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/asynctrace.cc
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#include "asynctrace.h"
+
+// The NLPUCCLIHooke namespace.
+namespace NLPUCCLIHooke {
+
+// Helper method put(...).
+void AsyncTrace::put(const Event event,
+                     const unsigned int iters,
+                     const unsigned long long funEvals,
+                     const double f,
+                     const double *x,
+                     const unsigned int n) {
+
+    unsigned int i;
+    unsigned int slot;
+
+    unsigned long long t = tail.load(std::memory_order_relaxed);
+
+    if (n > nVars) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+
+        return;
+    }
+
+    while ((t - head.load(std::memory_order_acquire)) >= capacity) {
+        if (policy == TRACE_DROP) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+
+            return;
+        }
+
+        std::this_thread::yield();
+    }
+
+    slot = t & (capacity - 1);
+
+    records[slot].event    = event;
+    records[slot].iters    = iters;
+    records[slot].funEvals = funEvals;
+    records[slot].f        = f;
+    records[slot].n        = n;
+
+    for (i = 0; i < n; i++) {
+        coords[(std::size_t) slot * nVars + i] = x[i];
+    }
+
+    tail.store(t + 1);
+
+    // The writer only gets a call when it has gone to sleep.
+    if (idle.load()) {
+        std::lock_guard<std::mutex> guard(lock);
+
+        wakeUp.notify_one();
+    }
+}
+
+// Helper method run().
+void AsyncTrace::run() {
+    unsigned int slot;
+
+    unsigned long long h;
+
+    for (;;) {
+        h = head.load(std::memory_order_relaxed);
+
+        if (h == tail.load(std::memory_order_acquire)) {
+            std::unique_lock<std::mutex> guard(lock);
+
+            idle.store(true);
+
+            drained.notify_all();
+
+            while ((h == tail.load()) && !stopping.load()) {
+                wakeUp.wait(guard);
+            }
+
+            idle.store(false);
+
+            if (h == tail.load()) {
+                return;
+            }
+
+            continue;
+        }
+
+        slot = h & (capacity - 1);
+
+        if (records[slot].event == EVENT_ITERATION) {
+            Trace::iteration(records[slot].iters, records[slot].funEvals,
+                             records[slot].f,
+                             &coords[(std::size_t) slot * nVars],
+                             records[slot].n);
+        } else {
+            Trace::summary(records[slot].iters, records[slot].funEvals,
+                           records[slot].f,
+                           &coords[(std::size_t) slot * nVars],
+                           records[slot].n);
+        }
+
+        head.store(h + 1, std::memory_order_release);
+    }
+}
+
+// Queues the state at the start of an iteration.
+void AsyncTrace::iteration(const unsigned int iters,
+                           const unsigned long long funEvals,
+                           const double f,
+                           const double *x,
+                           const unsigned int n) {
+
+    put(EVENT_ITERATION, iters, funEvals, f, x, n);
+}
+
+// Queues the end of a solve.
+void AsyncTrace::summary(const unsigned int iters,
+                         const unsigned long long funEvals,
+                         const double f,
+                         const double *x,
+                         const unsigned int n) {
+
+    put(EVENT_SUMMARY, iters, funEvals, f, x, n);
+}
+
+// Waits until the writer has written all the queued records.
+void AsyncTrace::flush() {
+    unsigned long long t = tail.load(std::memory_order_relaxed);
+
+    {
+        std::unique_lock<std::mutex> guard(lock);
+
+        wakeUp.notify_one();
+
+        while (head.load(std::memory_order_acquire) < t) {
+            drained.wait(guard);
+        }
+    }
+
+    // The writer is idle now, so the stream is ours.
+    Trace::flush();
+}
+
+// Getter for dropped.
+unsigned long long AsyncTrace::getDropped() const {
+    return dropped.load(std::memory_order_relaxed);
+}
+
+// Constructor.
+AsyncTrace::AsyncTrace(const unsigned int __nVars,
+                       const TracePolicy __policy,
+                       const unsigned int __capacity,
+                       std::ostream &__out,
+                       const TraceLevel __level,
+                       const TraceFormat __format,
+                       const unsigned int __every)
+    : Trace(__out, __level, __format, __every),
+      nVars(__nVars),
+      capacity(1),
+      policy(__policy),
+      head(0),
+      tail(0),
+      dropped(0),
+      idle(false),
+      stopping(false) {
+
+    while (capacity < __capacity) {
+        capacity <<= 1;
+    }
+
+    records.resize(capacity);
+    coords.resize((std::size_t) capacity * nVars);
+
+    writer = std::thread(&AsyncTrace::run, this);
+}
+
+// Destructor.
+AsyncTrace::~AsyncTrace() {
+    flush();
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+
+        stopping.store(true);
+
+        wakeUp.notify_one();
+    }
+
+    writer.join();
+}
+
+} // namespace NLPUCCLIHooke
+
+// vim:set nu et ts=4 sw=4:
@@ -0,0 +1,239 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/asynctrace.h
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#ifndef __CC__ASYNCTRACE_H
+#define __CC__ASYNCTRACE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "trace.h"
+
+/**
+ * The <code>NLPUCCLIHooke</code> namespace is used as a container
+ * for the <code>AsyncTrace</code> class.
+ */
+namespace NLPUCCLIHooke {
+
+/** Constant. The default number of records the ring buffer holds. */
+const unsigned int TRACE_RING_RECORDS = 1024;
+
+/** Constant. The size of a cache line (to keep the ring indices apart). */
+const unsigned int TRACE_CACHE_LINE = 64;
+
+/** What to do with a record when the ring buffer is full. */
+enum TracePolicy {
+    /** Drop the record (and count it): the solver never waits. */
+    TRACE_DROP,
+
+    /** Wait for the writer to make room: no record is lost. */
+    TRACE_BLOCK
+};
+
+/**
+ * The <code>AsyncTrace</code> class is a trace whose records get
+ * written by a background thread.
+ * <br />
+ * <br />The solver (the only producer) copies each record into a slot
+ * of a fixed-size single-producer/single-consumer ring buffer and goes on;
+ * the writer thread (the only consumer) formats the records onto
+ * the stream in the same way <code>Trace</code> does. The ring is
+ * lock-free: the producer and the consumer only share the two indices.
+ * When the ring is full, the record is either dropped or waited for,
+ * depending on the policy.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @see     Trace
+ * @since   hooke-jeeves 0.1
+ */
+class AsyncTrace : public Trace {
+private:
+    /** The record kinds. */
+    enum Event {
+        EVENT_ITERATION,
+        EVENT_SUMMARY
+    };
+
+    /** A record (the point is kept in the coordinates array). */
+    struct Record {
+        Event              event;
+        unsigned int       iters;
+        unsigned long long funEvals;
+        double             f;
+        unsigned int       n;
+    };
+
+    /** The maximum number of coordinates of a record. */
+    unsigned int nVars;
+
+    /** The number of slots (a power of two). */
+    unsigned int capacity;
+
+    /** What to do when the ring is full. */
+    TracePolicy policy;
+
+    /** The record slots. */
+    std::vector<Record> records;
+
+    /** The coordinates of the record slots (capacity rows of nVars). */
+    std::vector<double> coords;
+
+    /** The number of records taken by the writer (the consumer index). */
+    std::atomic<unsigned long long> head;
+
+    /** Padding: the two indices go to different cache lines. */
+    char headPad[TRACE_CACHE_LINE];
+
+    /** The number of records put by the solver (the producer index). */
+    std::atomic<unsigned long long> tail;
+
+    /** Padding: nor does anything else share the producer's line. */
+    char tailPad[TRACE_CACHE_LINE];
+
+    /** The number of records dropped. */
+    std::atomic<unsigned long long> dropped;
+
+    /** Whether the writer is (about to be) asleep. */
+    std::atomic<bool> idle;
+
+    /** Whether the writer has to quit once the ring is empty. */
+    std::atomic<bool> stopping;
+
+    /** The mutex of the writer's sleep. */
+    std::mutex lock;
+
+    /** The writer's wake-up call. */
+    std::condition_variable wakeUp;
+
+    /** The call of the writer running out of records. */
+    std::condition_variable drained;
+
+    /** The writer thread. */
+    std::thread writer;
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Puts a record into the ring (the producer side).
+     *
+     * @param event    The record kind.
+     * @param iters    The iteration number.
+     * @param funEvals The number of function evaluations so far.
+     * @param f        The objective function value at the point.
+     * @param x        The point.
+     * @param n        The number of coordinates of <code>x</code>.
+     */
+    void put(const Event,
+             const unsigned int,
+             const unsigned long long,
+             const double,
+             const double *,
+             const unsigned int);
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />The writer thread body (the consumer side).
+     */
+    void run();
+
+    /** Copying is not allowed. */
+    AsyncTrace(const AsyncTrace &);
+    AsyncTrace &operator=(const AsyncTrace &);
+
+public:
+    /**
+     * Queues the state at the start of an iteration.
+     *
+     * @param iters    The iteration number.
+     * @param funEvals The number of function evaluations so far.
+     * @param f        The objective function value at the base point.
+     * @param x        The base point.
+     * @param n        The number of coordinates of <code>x</code>.
+     */
+    virtual void iteration(const unsigned int,
+                           const unsigned long long,
+                           const double,
+                           const double *,
+                           const unsigned int);
+
+    /**
+     * Queues the end of a solve.
+     *
+     * @param iters    The number of iterations used.
+     * @param funEvals The number of function evaluations used.
+     * @param f        The objective function value at the ending point.
+     * @param x        The ending point.
+     * @param n        The number of coordinates of <code>x</code>.
+     */
+    virtual void summary(const unsigned int,
+                         const unsigned long long,
+                         const double,
+                         const double *,
+                         const unsigned int);
+
+    /** Waits until the writer has written all the queued records. */
+    virtual void flush();
+
+    /**
+     * Getter for <code>dropped</code>.
+     *
+     * @return The number of records dropped because the ring was full
+     *         (or because they had more than <code>nVars</code>
+     *         coordinates).
+     */
+    unsigned long long getDropped() const;
+
+    /**
+     * Constructor.
+     *
+     * @param __nVars    The maximum number of coordinates of a record.
+     * @param __policy   What to do when the ring is full.
+     * @param __capacity The number of records the ring holds (rounded up
+     *                   to a power of two).
+     * @param __out      The stream to write the records to.
+     * @param __level    The amount of the progress to report.
+     * @param __format   The layout of the records.
+     * @param __every    The iteration step of <code>TRACE_EVERY</code>.
+     */
+    AsyncTrace(const unsigned int,
+               const TracePolicy = TRACE_BLOCK,
+               const unsigned int = TRACE_RING_RECORDS,
+               std::ostream & = std::cout,
+               const TraceLevel = TRACE_FULL,
+               const TraceFormat = TRACE_TEXT,
+               const unsigned int = 1);
+
+    /** Destructor. Writes out the queued records and stops the writer. */
+    virtual ~AsyncTrace();
+};
+
+} // namespace NLPUCCLIHooke
+
+#endif // __CC__ASYNCTRACE_H
+
+// vim:set nu et ts=4 sw=4:
@@ -0,0 +1,600 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/batchio.cc
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "batchio.h"
+
+// The NLPUCCLIHooke namespace.
+namespace NLPUCCLIHooke {
+
+// Helper constant (the room for one formatted number and a comma).
+const unsigned int BATCH_NUMBER_SIZE = 32;
+
+// Helper constant (the number of the rho and epsilon columns).
+const unsigned int BATCH_PARAM_COLUMNS = 2;
+
+// Helper function.
+// Tells whether a CSV line is blank or a comment.
+static bool skipped(const char *p) {
+    while (std::isspace((unsigned char) *p)) {
+        p++;
+    }
+
+    return ((*p == '\0') || (*p == '#'));
+}
+
+// Helper method nextLine().
+bool StartFile::nextLine() {
+    const char *end;
+
+    std::size_t length;
+
+    if (offset >= size) {
+        return false;
+    }
+
+    end = (const char *) std::memchr(data + offset, '\n', size - offset);
+
+    length = (end != NULL) ? (std::size_t) (end - (data + offset))
+                           : size - offset;
+
+    // Lines are copied out: the mapping is not NUL-terminated.
+    text.assign(data + offset, length);
+
+    if ((length > 0) && (text[length - 1] == '\r')) {
+        text.resize(length - 1);
+    }
+
+    offset += length + 1;
+    line++;
+
+    return true;
+}
+
+// Helper method parseHeader().
+void StartFile::parseHeader() {
+    const char *p;
+
+    std::size_t start;
+
+    unsigned int count;
+
+    std::vector<std::string> columns;
+    std::string column;
+
+    do {
+        start = offset;
+
+        if (!nextLine()) {
+            return;
+        }
+    } while (skipped(text.c_str()));
+
+    p = text.c_str();
+
+    while (std::isspace((unsigned char) *p)) {
+        p++;
+    }
+
+    // A data row: every column is a coordinate, and it is read again.
+    if (std::isdigit((unsigned char) *p) || (*p == '-') || (*p == '+')
+        || (*p == '.')) {
+
+        count = 0;
+
+        for (; *p != '\0'; p++) {
+            count += (*p == ',');
+        }
+
+        nVars  = count + 1;
+        offset = start;
+        line--;
+
+        return;
+    }
+
+    for (; ; p++) {
+        if ((*p == ',') || (*p == '\0')) {
+            columns.push_back(column);
+            column.clear();
+
+            if (*p == '\0') {
+                break;
+            }
+        } else if (!std::isspace((unsigned char) *p)) {
+            column += *p;
+        }
+    }
+
+    named  = (columns[0] == "problem");
+    params = (columns.size() > BATCH_PARAM_COLUMNS + (named ? 1 : 0))
+          && (columns[columns.size() - 2] == "rho")
+          && (columns[columns.size() - 1] == "epsilon");
+
+    nVars = columns.size() - (params ? BATCH_PARAM_COLUMNS : 0)
+                           - (named  ? 1                   : 0);
+}
+
+// Helper method parseName(...).
+const char *StartFile::parseName(unsigned int *problem) {
+    const char *p = text.c_str();
+    const char *end;
+    const char *comma;
+
+    unsigned int k;
+
+    while (std::isspace((unsigned char) *p)) {
+        p++;
+    }
+
+    if ((comma = std::strchr(p, ',')) == NULL) {
+        return NULL;
+    }
+
+    end = comma;
+
+    while ((end > p) && std::isspace((unsigned char) end[-1])) {
+        end--;
+    }
+
+    for (k = 0; k < problems.size(); k++) {
+        if (problems[k].compare(0, std::string::npos, p, end - p) == 0) {
+            *problem = k;
+
+            return (comma + 1);
+        }
+    }
+
+    return NULL;
+}
+
+// Helper method parseLine(...).
+unsigned int StartFile::parseLine(const char *p,
+                                  double *values,
+                                  const unsigned int max) {
+
+    char *end;
+
+    unsigned int count = 0;
+
+    for (; ; ) {
+        double v = std::strtod(p, &end);
+
+        if (end == p) {
+            return 0;
+        }
+
+        if (count == max) {
+            return (max + 1);
+        }
+
+        values[count++] = v;
+
+        while (std::isspace((unsigned char) *end)) {
+            end++;
+        }
+
+        if (*end == '\0') {
+            return count;
+        }
+
+        if (*end != ',') {
+            return 0;
+        }
+
+        p = end + 1;
+    }
+}
+
+// Maps a start-point file.
+bool StartFile::open(const char *path) {
+    int fd;
+
+    struct stat st;
+
+    BatchHeader h;
+
+    if ((fd = ::open(path, O_RDONLY)) < 0) {
+        return false;
+    }
+
+    if ((fstat(fd, &st) != 0) || (st.st_size == 0)) {
+        ::close(fd);
+
+        return false;
+    }
+
+    size = st.st_size;
+    data = (const char *) mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    ::close(fd);
+
+    if (data == MAP_FAILED) {
+        data = NULL;
+
+        return false;
+    }
+
+    madvise((void *) data, size, MADV_SEQUENTIAL);
+
+    if ((size >= sizeof(h))
+        && (std::memcmp(data, BATCH_START_MAGIC, BATCH_MAGIC_SIZE) == 0)) {
+
+        std::memcpy(&h, data, sizeof(h));
+
+        binary = true;
+        params = ((h.flags & BATCH_PARAMS) != 0);
+        nVars  = h.nVars;
+        offset = sizeof(h);
+
+        return ((h.version == BATCH_VERSION) && (nVars > 0)
+             && (h.rowSize == (nVars + (params ? BATCH_PARAM_COLUMNS : 0))
+                              * sizeof(double)));
+    }
+
+    parseHeader();
+
+    return (nVars > 0);
+}
+
+// Setter for problems.
+void StartFile::setProblems(const std::vector<std::string> &__problems) {
+    problems = __problems;
+}
+
+// Reads the next chunk of rows.
+unsigned int StartFile::read(BatchChunk &chunk,
+                             const unsigned int maxRows,
+                             const double *rho,
+                             const double epsilon) {
+
+    const char *p;
+
+    unsigned int k;
+    unsigned int i;
+    unsigned int n = 0;
+    unsigned int m = nVars + (params ? BATCH_PARAM_COLUMNS : 0);
+
+    std::size_t rows;
+
+    std::vector<double> values(m);
+
+    // A malformed row ends the whole batch, not just its chunk.
+    if (malformed) {
+        chunk.nRows = 0;
+
+        return 0;
+    }
+
+    if (chunk.startPts.size() < (std::size_t) maxRows * nVars) {
+        chunk.startPts.resize((std::size_t) maxRows * nVars);
+        chunk.endPts.resize((std::size_t) maxRows * nVars);
+        chunk.problem.resize(maxRows);
+        chunk.rho.resize(maxRows);
+        chunk.epsilon.resize(maxRows);
+        chunk.iters.resize(maxRows);
+        chunk.evals.resize(maxRows);
+        chunk.fEnd.resize(maxRows);
+    }
+
+    if (binary) {
+        rows = (size - offset) / (m * sizeof(double));
+        n    = (rows < maxRows) ? rows : maxRows;
+
+        for (k = 0; k < n; k++) {
+            std::memcpy(&values[0], data + offset, m * sizeof(double));
+
+            offset += m * sizeof(double);
+
+            for (i = 0; i < nVars; i++) {
+                chunk.startPts[(std::size_t) k * nVars + i] = values[i];
+            }
+
+            chunk.problem[k] = 0;
+            chunk.rho[k]     = params ? values[nVars] : rho[0];
+            chunk.epsilon[k] = params ? values[nVars + 1] : epsilon;
+        }
+
+        // A truncated trailing row.
+        if ((n == 0) && (offset < size)) {
+            malformed = true;
+        }
+
+        chunk.nRows = n;
+
+        return n;
+    }
+
+    while ((n < maxRows) && nextLine()) {
+        if (skipped(text.c_str())) {
+            continue;
+        }
+
+        chunk.problem[n] = 0;
+
+        p = named ? parseName(&chunk.problem[n]) : text.c_str();
+
+        if ((p == NULL) || (parseLine(p, &values[0], m) != m)) {
+            malformed = true;
+
+            break;
+        }
+
+        for (i = 0; i < nVars; i++) {
+            chunk.startPts[(std::size_t) n * nVars + i] = values[i];
+        }
+
+        chunk.rho[n]     = params ? values[nVars] : rho[chunk.problem[n]];
+        chunk.epsilon[n] = params ? values[nVars + 1] : epsilon;
+
+        n++;
+    }
+
+    chunk.nRows = n;
+
+    return n;
+}
+
+// Getter for nVars.
+unsigned int StartFile::getNVars() const {
+    return nVars;
+}
+
+// Getter for binary.
+bool StartFile::isBinary() const {
+    return binary;
+}
+
+// Getter for named.
+bool StartFile::isNamed() const {
+    return named;
+}
+
+// Getter for malformed.
+bool StartFile::isMalformed() const {
+    return malformed;
+}
+
+// Getter for line.
+unsigned long long StartFile::getLine() const {
+    return line;
+}
+
+// Default constructor.
+StartFile::StartFile()
+    : data(NULL),
+      size(0),
+      offset(0),
+      binary(false),
+      params(false),
+      named(false),
+      nVars(0),
+      line(0),
+      malformed(false) {}
+
+// Destructor.
+StartFile::~StartFile() {
+    if (data != NULL) {
+        munmap((void *) data, size);
+    }
+}
+
+// Helper method format(...).
+void ResultWriter::format(const BatchChunk &c) {
+    unsigned int k;
+    unsigned int i;
+
+    char buf[BATCH_NUMBER_SIZE];
+
+    std::uint32_t counts[2];
+
+    std::string row;
+
+    for (k = 0; k < c.nRows; k++) {
+        const double *x = &c.endPts[(std::size_t) k * nVars];
+
+        if (binary) {
+            counts[0] = c.iters[k];
+            counts[1] = c.evals[k];
+
+            out.write((const char *) counts, sizeof(counts));
+            out.write((const char *) &c.fEnd[k], sizeof(double));
+            out.write((const char *) x, nVars * sizeof(double));
+
+            continue;
+        }
+
+        std::snprintf(buf, BATCH_NUMBER_SIZE, "%llu,%u,%u,",
+                      c.first + k, c.iters[k], c.evals[k]);
+
+        row = buf;
+
+        std::snprintf(buf, BATCH_NUMBER_SIZE, "%.17g", c.fEnd[k]);
+
+        row += buf;
+
+        for (i = 0; i < nVars; i++) {
+            std::snprintf(buf, BATCH_NUMBER_SIZE, ",%.17g", x[i]);
+
+            row += buf;
+        }
+
+        row += '\n';
+
+        out.write(row.data(), row.size());
+    }
+}
+
+// Helper method run().
+void ResultWriter::run() {
+    const BatchChunk *c;
+
+    for (; ; ) {
+        {
+            std::unique_lock<std::mutex> guard(lock);
+
+            while ((chunk == NULL) && !stopping) {
+                posted.wait(guard);
+            }
+
+            if (chunk == NULL) {
+                return;
+            }
+
+            c = chunk;
+        }
+
+        format(*c);
+
+        {
+            std::lock_guard<std::mutex> guard(lock);
+
+            chunk = NULL;
+        }
+
+        written.notify_all();
+    }
+}
+
+// Creates the result file, writes its header and starts the writer.
+bool ResultWriter::open(const char *path,
+                        const unsigned int __nVars,
+                        const bool __binary) {
+
+    unsigned int i;
+
+    BatchHeader h;
+
+    nVars  = __nVars;
+    binary = __binary;
+
+    buffer.resize(BATCH_BUFFER_SIZE);
+
+    out.rdbuf()->pubsetbuf(&buffer[0], buffer.size());
+    out.open(path, binary ? (std::ios::out | std::ios::binary)
+                          : std::ios::out);
+
+    if (!out) {
+        return false;
+    }
+
+    if (binary) {
+        std::memset(&h, 0, sizeof(h));
+        std::memcpy(h.magic, BATCH_RESULT_MAGIC, BATCH_MAGIC_SIZE);
+
+        h.version = BATCH_VERSION;
+        h.nVars   = nVars;
+        h.rowSize = 2 * sizeof(std::uint32_t) + (nVars + 1) * sizeof(double);
+
+        out.write((const char *) &h, sizeof(h));
+    } else {
+        out << "row,iters,funevals,f";
+
+        for (i = 0; i < nVars; i++) {
+            out << ",x" << i;
+        }
+
+        out << "\n";
+    }
+
+    writer = std::thread(&ResultWriter::run, this);
+
+    return true;
+}
+
+// Hands a chunk over to the writer.
+void ResultWriter::post(const BatchChunk &c) {
+    {
+        std::unique_lock<std::mutex> guard(lock);
+
+        while (chunk != NULL) {
+            written.wait(guard);
+        }
+
+        chunk = &c;
+    }
+
+    posted.notify_one();
+}
+
+// Blocks until the chunk handed over has been written.
+void ResultWriter::wait() {
+    std::unique_lock<std::mutex> guard(lock);
+
+    while (chunk != NULL) {
+        written.wait(guard);
+    }
+}
+
+// Writes out the buffered rows, stops the writer and closes the file.
+bool ResultWriter::close() {
+    bool ok;
+
+    if (!writer.joinable()) {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+
+        stopping = true;
+    }
+
+    posted.notify_one();
+    writer.join();
+
+    out.flush();
+
+    ok = out.good();
+
+    out.close();
+
+    return (ok && !out.fail());
+}
+
+// Default constructor.
+ResultWriter::ResultWriter()
+    : binary(false),
+      nVars(0),
+      chunk(NULL),
+      stopping(false) {}
+
+// Destructor.
+ResultWriter::~ResultWriter() {
+    if (writer.joinable()) {
+        close();
+    }
+}
+
+} // namespace NLPUCCLIHooke
+
+// vim:set nu et ts=4 sw=4:
@@ -0,0 +1,427 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/batchio.h
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#ifndef __CC__BATCHIO_H
+#define __CC__BATCHIO_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * The <code>NLPUCCLIHooke</code> namespace is used as a container
+ * for the <code>StartFile</code> and <code>ResultWriter</code> classes.
+ */
+namespace NLPUCCLIHooke {
+
+/** Constant. The magic bytes a binary start-point file starts with. */
+const char BATCH_START_MAGIC[] = "NLPS";
+
+/** Constant. The magic bytes a binary result file starts with. */
+const char BATCH_RESULT_MAGIC[] = "NLPR";
+
+/** Constant. The number of the magic bytes. */
+const unsigned int BATCH_MAGIC_SIZE = 4;
+
+/** Constant. The binary start-point and result formats version. */
+const std::uint16_t BATCH_VERSION = 1;
+
+/** Constant. The header flag of the rows carrying rho and epsilon. */
+const std::uint16_t BATCH_PARAMS = 1;
+
+/** Constant. The number of rows read, solved and written at a time. */
+const unsigned int BATCH_CHUNK_ROWS = 4096;
+
+/** Constant. The size of the result file stream buffer (1 MiB). */
+const unsigned int BATCH_BUFFER_SIZE = 1 << 20;
+
+/**
+ * The binary start-point and result file header (16 bytes, no padding).
+ * <br />
+ * <br />A start-point row is then <code>nVars</code> doubles,
+ * followed by rho and epsilon if the <code>BATCH_PARAMS</code> flag
+ * is set. A result row is the number of iterations and of function
+ * evaluations (two <code>uint32_t</code>), f(x) and the <code>nVars</code>
+ * coordinates of the ending point. All the fields are in the byte order
+ * of the machine that has written the file.
+ */
+struct BatchHeader {
+    /** The magic bytes. */
+    char magic[BATCH_MAGIC_SIZE];
+
+    /** The format version (<code>BATCH_VERSION</code>). */
+    std::uint16_t version;
+
+    /** The flags (<code>BATCH_PARAMS</code>). */
+    std::uint16_t flags;
+
+    /** The number of coordinates of every row. */
+    std::uint32_t nVars;
+
+    /** The size of a row in bytes. */
+    std::uint32_t rowSize;
+};
+
+/**
+ * A chunk of the rows of a batch: the problems as read,
+ * and their solutions.
+ */
+struct BatchChunk {
+    /** The number of rows in the chunk. */
+    unsigned int nRows;
+
+    /** The index of the first row (in the whole batch). */
+    unsigned long long first;
+
+    /**
+     * The per-row problem (the index of the name in the table
+     * of <code>StartFile::setProblems()</code>, or 0).
+     */
+    std::vector<unsigned int> problem;
+
+    /** The starting points (<code>nRows</code> rows of nVars). */
+    std::vector<double> startPts;
+
+    /** The per-row rho values. */
+    std::vector<double> rho;
+
+    /** The per-row epsilon values. */
+    std::vector<double> epsilon;
+
+    /** The ending points (the same layout as the starting ones). */
+    std::vector<double> endPts;
+
+    /** The per-row number of iterations. */
+    std::vector<unsigned int> iters;
+
+    /** The per-row number of function evaluations. */
+    std::vector<unsigned int> evals;
+
+    /** The per-row objective function value at the ending point. */
+    std::vector<double> fEnd;
+};
+
+/**
+ * The <code>StartFile</code> class reads the starting points
+ * of a batch from a memory-mapped file, a chunk of rows at a time.
+ * <br />
+ * <br />The file is either a binary one (see <code>BatchHeader</code>)
+ * or a CSV one: an optional header line, then one row per line.
+ * A CSV row is the coordinates of a starting point, followed by rho
+ * and epsilon if the header names them (the last two columns
+ * <code>rho</code> and <code>epsilon</code>). If the header names
+ * a first column <code>problem</code>, every row starts with the name
+ * of the problem it is a start of, so one batch can mix the problems
+ * (that take the same number of variables). Without a header, every
+ * column is a coordinate. Blank lines and lines starting with
+ * <code>#</code> are skipped.
+ * <br />
+ * <br />Nothing but the mapping is held: the pages are read in place,
+ * ahead of the cursor (the mapping is advised as a sequential one).
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @see     ResultWriter
+ * @since   hooke-jeeves 0.1
+ */
+class StartFile {
+private:
+    /** The mapped file contents. */
+    const char *data;
+
+    /** The size of the file. */
+    std::size_t size;
+
+    /** The read cursor. */
+    std::size_t offset;
+
+    /** Whether the file is a binary one. */
+    bool binary;
+
+    /** Whether the rows carry rho and epsilon. */
+    bool params;
+
+    /** Whether the rows start with a problem name (of a CSV file). */
+    bool named;
+
+    /** The problem names the rows may start with. */
+    std::vector<std::string> problems;
+
+    /** The number of coordinates of every row. */
+    unsigned int nVars;
+
+    /** The number of the current line (of a CSV file). */
+    unsigned long long line;
+
+    /** Whether a malformed row has been met. */
+    bool malformed;
+
+    /** The current line (of a CSV file), NUL-terminated. */
+    std::string text;
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Takes the next line of a CSV file into <code>text</code>.
+     *
+     * @return <code>false</code> at the end of the file.
+     */
+    bool nextLine();
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Parses the first meaningful line of a CSV file: the header,
+     * or else the first row (which is then left to be read).
+     */
+    void parseHeader();
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Parses the problem name a CSV line starts with.
+     *
+     * @param problem The index of the name in <code>problems</code>
+     *                (output).
+     *
+     * @return The rest of the line (after the comma), or <code>NULL</code>
+     *         if the name is not one of <code>problems</code>.
+     */
+    const char *parseName(unsigned int *);
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Parses the values of (the rest of) a CSV line.
+     *
+     * @param p      The first value.
+     * @param values The values (output, up to <code>max</code>).
+     * @param max    The maximum number of values.
+     *
+     * @return The number of values, or <code>max + 1</code> if there
+     *         are more, or 0 if one is not a number.
+     */
+    unsigned int parseLine(const char *, double *, const unsigned int);
+
+    /** Copying is not allowed. */
+    StartFile(const StartFile &);
+    StartFile &operator=(const StartFile &);
+
+public:
+    /**
+     * Maps a start-point file.
+     *
+     * @param path The file path.
+     *
+     * @return <code>false</code> if the file cannot be read
+     *         or is not a start-point one.
+     */
+    bool open(const char *);
+
+    /**
+     * Setter for the problem names the rows may start with
+     * (to be called before reading a file that has a problem column).
+     * A row starting with another name is a malformed one.
+     *
+     * @param __problems The problem names.
+     */
+    void setProblems(const std::vector<std::string> &);
+
+    /**
+     * Reads the next chunk of rows.
+     *
+     * @param chunk   The chunk to fill (the arrays get resized).
+     * @param maxRows The maximum number of rows to read.
+     * @param rho     The per-problem rho value of the rows
+     *                not carrying one (the one value of a file
+     *                without a problem column).
+     * @param epsilon The epsilon value of the rows not carrying one.
+     *
+     * @return The number of rows read (0 at the end of the file
+     *         or at a malformed row, and from then on).
+     */
+    unsigned int read(BatchChunk &,
+                      const unsigned int,
+                      const double *,
+                      const double);
+
+    /**
+     * Getter for <code>nVars</code>.
+     *
+     * @return The number of coordinates of every row.
+     */
+    unsigned int getNVars() const;
+
+    /**
+     * Getter for <code>binary</code>.
+     *
+     * @return Whether the file is a binary one.
+     */
+    bool isBinary() const;
+
+    /**
+     * Getter for <code>named</code>.
+     *
+     * @return Whether the rows start with a problem name.
+     */
+    bool isNamed() const;
+
+    /**
+     * Getter for <code>malformed</code>.
+     *
+     * @return Whether the reading has stopped at a malformed row.
+     */
+    bool isMalformed() const;
+
+    /**
+     * Getter for <code>line</code>.
+     *
+     * @return The number of the last line read (of a CSV file);
+     *         the one of the malformed row once reading has stopped.
+     */
+    unsigned long long getLine() const;
+
+    /** Default constructor. */
+    StartFile();
+
+    /** Destructor. Unmaps the file. */
+    ~StartFile();
+};
+
+/**
+ * The <code>ResultWriter</code> class streams the solutions of a batch
+ * to a file from a thread of its own, so that writing a chunk overlaps
+ * with solving the next one.
+ * <br />
+ * <br />The results go out as CSV (a header line, then the row index,
+ * the number of iterations and of function evaluations, f(x)
+ * and the ending point, with 17 significant digits), or as binary
+ * rows (see <code>BatchHeader</code>).
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @see     StartFile
+ * @since   hooke-jeeves 0.1
+ */
+class ResultWriter {
+private:
+    /** The file stream buffer (has to outlive the stream). */
+    std::vector<char> buffer;
+
+    /** The file. */
+    std::ofstream out;
+
+    /** Whether the results go out as binary rows. */
+    bool binary;
+
+    /** The number of coordinates of every row. */
+    unsigned int nVars;
+
+    /** The chunk being written, if any. */
+    const BatchChunk *chunk;
+
+    /** Whether the writer has to quit. */
+    bool stopping;
+
+    /** The lock guarding the chunk hand-over. */
+    std::mutex lock;
+
+    /** Signalled when a chunk is handed over, or on shutdown. */
+    std::condition_variable posted;
+
+    /** Signalled when the chunk has been written. */
+    std::condition_variable written;
+
+    /** The writer thread. */
+    std::thread writer;
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Formats the rows of a chunk onto the file.
+     *
+     * @param c The chunk.
+     */
+    void format(const BatchChunk &);
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />The writer thread body.
+     */
+    void run();
+
+    /** Copying is not allowed. */
+    ResultWriter(const ResultWriter &);
+    ResultWriter &operator=(const ResultWriter &);
+
+public:
+    /**
+     * Creates the result file, writes its header and starts the writer.
+     *
+     * @param path     The file path.
+     * @param __nVars  The number of coordinates of every row.
+     * @param __binary Whether the results go out as binary rows.
+     *
+     * @return <code>false</code> if the file cannot be created.
+     */
+    bool open(const char *, const unsigned int, const bool);
+
+    /**
+     * Hands a chunk over to the writer (after the previous one
+     * has been written). The chunk must stay untouched until
+     * <code>wait()</code> returns.
+     *
+     * @param c The chunk.
+     */
+    void post(const BatchChunk &);
+
+    /** Blocks until the chunk handed over has been written. */
+    void wait();
+
+    /**
+     * Writes out the buffered rows, stops the writer
+     * and closes the file.
+     *
+     * @return <code>false</code> if some of the rows could not
+     *         be written.
+     */
+    bool close();
+
+    /** Default constructor. */
+    ResultWriter();
+
+    /** Destructor. Closes the file, if still open. */
+    ~ResultWriter();
+};
+
+} // namespace NLPUCCLIHooke
+
+#endif // __CC__BATCHIO_H
+
+// vim:set nu et ts=4 sw=4:
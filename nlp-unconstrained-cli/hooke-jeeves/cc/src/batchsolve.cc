@@ -0,0 +1,116 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/batchsolve.cc
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#include "batchsolve.h"
+
+// The NLPUCCLIHooke namespace.
+namespace NLPUCCLIHooke {
+
+// Helper method solve(...).
+void BatchSolve::solve(BatchChunk &c,
+                       const unsigned int nVars,
+                       const unsigned int iterMax) {
+
+    unsigned int k;
+
+    BatchChunk *chunk = &c;
+
+    for (k = 0; k < c.nRows; k += BATCH_TASK_ROWS) {
+        pool.submit([=](const unsigned int w) {
+            unsigned int r;
+            unsigned int last = (k + BATCH_TASK_ROWS < chunk->nRows)
+                              ? k + BATCH_TASK_ROWS : chunk->nRows;
+
+            for (r = k; r < last; r++) {
+                std::size_t row = (std::size_t) r * nVars;
+
+                chunk->iters[r] = solvers[chunk->problem[r]]->solve(
+                    w, nVars, &chunk->startPts[row], &chunk->endPts[row],
+                    chunk->rho[r], chunk->epsilon[r], iterMax,
+                    &chunk->evals[r], &chunk->fEnd[r]);
+            }
+        });
+    }
+}
+
+// Main driver method batchSolve(...).
+unsigned long long BatchSolve::batchSolve(StartFile &in,
+                                          ResultWriter &out,
+                                          const double *rho,
+                                          const double epsilon,
+                                          const unsigned int iterMax) {
+
+    unsigned int k;
+    unsigned int n;
+    unsigned int s = 0;
+    unsigned int nVars = in.getNVars();
+
+    unsigned long long total = 0;
+
+    BatchChunk chunks[BATCH_CHUNKS];
+
+    for (k = 0; k < solvers.size(); k++) {
+        solvers[k]->fit(nVars);
+    }
+
+    chunks[s].first = 0;
+
+    n = in.read(chunks[s], BATCH_CHUNK_ROWS, rho, epsilon);
+
+    while (n > 0) {
+        BatchChunk &c    = chunks[s];
+        BatchChunk &next = chunks[(s + 1) % BATCH_CHUNKS];
+
+        solve(c, nVars, iterMax);
+
+        /*
+         * Reading the next chunk overlaps with the solves. Its slot
+         * has been written out before the previous chunk was posted.
+         */
+        next.first = total + n;
+
+        n = in.read(next, BATCH_CHUNK_ROWS, rho, epsilon);
+
+        pool.wait();
+
+        // Writing the chunk overlaps with solving the next one.
+        out.post(c);
+
+        total += c.nRows;
+
+        s = (s + 1) % BATCH_CHUNKS;
+    }
+
+    out.wait();
+
+    return total;
+}
+
+// Constructor.
+BatchSolve::BatchSolve(ThreadPool &__pool,
+                       const std::vector<Solvers *> &__solvers)
+    : pool(__pool), solvers(__solvers) {}
+
+} // namespace NLPUCCLIHooke
+
+// vim:set nu et ts=4 sw=4:
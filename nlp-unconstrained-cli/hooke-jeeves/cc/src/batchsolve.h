@@ -0,0 +1,129 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/batchsolve.h
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#ifndef __CC__BATCHSOLVE_H
+#define __CC__BATCHSOLVE_H
+
+#include <vector>
+
+#include "solverset.h"
+#include "threadpool.h"
+#include "batchio.h"
+
+/**
+ * The <code>NLPUCCLIHooke</code> namespace is used as a container
+ * for the <code>BatchSolve</code> class.
+ */
+namespace NLPUCCLIHooke {
+
+/** Constant. The number of rows a pool task solves. */
+const unsigned int BATCH_TASK_ROWS = 64;
+
+/** Constant. The number of chunks in flight (read, solved, written). */
+const unsigned int BATCH_CHUNKS = 3;
+
+/**
+ * The <code>BatchSolve</code> class is a driver that solves every row
+ * of a start-point file and streams the solutions to a result file.
+ * <br />
+ * <br />The rows go through a three-stage pipeline, a chunk
+ * at a time: while the pool solves chunk k, the calling thread reads
+ * chunk k + 1 from the mapping and the writer thread writes chunk k - 1.
+ * The memory used does not depend on the number of rows.
+ * <br />
+ * <br />Each row is solved by the solvers of its problem (see
+ * <code>BatchChunk::problem</code>), which are specialized
+ * for the objective function of the problem. As in
+ * <code>MultiStart</code>, every worker owns its solver instances
+ * (see <code>SolverSet</code>), so the solves share nothing.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @see     StartFile
+ * @see     ResultWriter
+ * @see     MultiStart
+ * @see     SolverSet
+ * @since   hooke-jeeves 0.1
+ */
+class BatchSolve {
+private:
+    /** The thread pool to run the solves on. */
+    ThreadPool &pool;
+
+    /** The per-problem solvers (not owned). */
+    const std::vector<Solvers *> &solvers;
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Queues the solves of the rows of a chunk to the pool
+     * (without waiting for them).
+     *
+     * @param c       The chunk.
+     * @param nVars   The number of variables.
+     * @param iterMax The maximum number of iterations.
+     */
+    void solve(BatchChunk &, const unsigned int, const unsigned int);
+
+    /** Copying is not allowed. */
+    BatchSolve(const BatchSolve &);
+    BatchSolve &operator=(const BatchSolve &);
+
+public:
+    /**
+     * Main driver method.
+     * <br />
+     * <br />Solves all the rows of the start-point file.
+     *
+     * @param in      The start-point file.
+     * @param out     The result file (opened for the same number
+     *                of variables).
+     * @param rho     The per-problem rho value of the rows
+     *                not carrying one.
+     * @param epsilon The epsilon value of the rows not carrying one.
+     * @param iterMax The maximum number of iterations.
+     *
+     * @return The number of rows solved.
+     */
+    unsigned long long batchSolve(StartFile &,
+                                  ResultWriter &,
+                                  const double *,
+                                  const double,
+                                  const unsigned int);
+
+    /**
+     * Constructor.
+     *
+     * @param __pool    The thread pool to run the solves on.
+     * @param __solvers The per-problem solvers (made for as many
+     *                  workers as the pool has), indexed as the problems
+     *                  of the start-point file.
+     */
+    BatchSolve(ThreadPool &, const std::vector<Solvers *> &);
+};
+
+} // namespace NLPUCCLIHooke
+
+#endif // __CC__BATCHSOLVE_H
+
+// vim:set nu et ts=4 sw=4:
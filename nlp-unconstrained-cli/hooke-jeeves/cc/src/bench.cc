@@ -0,0 +1,250 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/bench.cc
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#include <cstring>
+#include <fstream>
+
+#include "rosenbrock.h"
+#include "woods.h"
+#include "hooke.h"
+#include "microbench.h"
+
+using namespace NLPUCCLIHooke;
+
+// Helper constants.
+const unsigned int BENCH_DIMS[]         = {2, 4, 16, 128, 1024, 10000};
+const unsigned int BENCH_N_DIMS         = sizeof(BENCH_DIMS)
+                                        / sizeof(BENCH_DIMS[0]);
+const unsigned int BENCH_SWEEP_MAX_VARS = 1024;
+const unsigned int BENCH_SOLVE_MAX_VARS = 16;
+const unsigned int BENCH_SWEEP_ITERS    = 1;
+
+// Helper variable (the results of the timed calls are stored away here).
+static volatile double sink;
+
+/**
+ * Helper function.
+ * <br />
+ * <br />Matches a command-line option of the form <code>--name=value</code>.
+ *
+ * @param arg  The command-line argument.
+ * @param name The option name (including the leading dashes).
+ *
+ * @return The option value, or <code>NULL</code> if the argument
+ *         is not the option given.
+ */
+static const char *optionValue(const char *arg, const char *name) {
+    std::size_t len = std::strlen(name);
+
+    if ((std::strncmp(arg, name, len) != 0) || (arg[len] != '=')) {
+        return NULL;
+    }
+
+    return (arg + len + 1);
+}
+
+/**
+ * Helper function.
+ * <br />
+ * <br />Times an operation and prints and records its timings.
+ *
+ * @param bench   The harness.
+ * @param op      The operation (see <code>MicroBench::run()</code>).
+ * @param metric  The operation name.
+ * @param func    The objective function name.
+ * @param nVars   The number of variables.
+ * @param unit    The unit the times are given per.
+ * @param results The results (appended to).
+ */
+template<typename Op>
+static void measure(MicroBench &bench,
+                    Op op,
+                    const char *metric,
+                    const char *func,
+                    const unsigned int nVars,
+                    const char *unit,
+                    std::vector<MicroResult> &results) {
+
+    MicroResult r;
+
+    r.metric = metric;
+    r.func   = func;
+    r.nVars  = nVars;
+    r.unit   = unit;
+    r.stats  = bench.run(op);
+
+    results.push_back(r);
+
+    std::cout << std::setw(8) << metric << std::setw(12) << func
+              << std::setw(9) << nVars << std::setw(12) << r.stats.batch
+              << std::fixed << std::setprecision(1)
+              << std::setw(13) << r.stats.min
+              << std::setw(13) << r.stats.median
+              << std::setw(13) << r.stats.p90
+              << std::setw(13) << r.stats.max
+              << "  " << unit << std::endl;
+}
+
+/**
+ * Helper function.
+ * <br />
+ * <br />Measures the hot path of the solver on a problem: an objective
+ * function call, an exploratory sweep (<code>bestNearby()</code>,
+ * timed over the sweeps of one-iteration solves, which includes
+ * their share of the starting point evaluation) and a full solve.
+ * The sweeps and the solves go through the default solver setup,
+ * with a workspace of their own (no allocations timed), and are only
+ * measured up to <code>BENCH_SWEEP_MAX_VARS</code>
+ * and <code>BENCH_SOLVE_MAX_VARS</code> variables.
+ *
+ * @param bench   The harness.
+ * @param name    The problem name.
+ * @param nVars   The number of variables.
+ * @param startPt The starting point coordinates.
+ * @param rho     The rho value.
+ * @param results The results (appended to).
+ */
+template<typename Objective>
+static void hotPath(MicroBench &bench,
+                    const char *name,
+                    const unsigned int nVars,
+                    const double *startPt,
+                    const double rho,
+                    std::vector<MicroResult> &results) {
+
+    std::vector<double> endPt(nVars);
+
+    FunEvals fe;
+
+    Hooke<Objective> h;
+    Workspace ws(nVars);
+
+    h.setTrace(false);
+    h.setWorkspace(&ws);
+
+    measure(bench, [&]() -> unsigned long long {
+        sink = Objective::f(startPt, nVars, &fe);
+
+        // The point might have changed: no call can be hoisted.
+        __asm__ __volatile__("" : : "g"(startPt) : "memory");
+
+        return 1;
+    }, "f", name, nVars, "ns/call", results);
+
+    if (nVars <= BENCH_SWEEP_MAX_VARS) {
+        measure(bench, [&]() -> unsigned long long {
+            fe.reset();
+
+            h.hooke(nVars, startPt, &endPt[0], rho, EPSMIN,
+                    BENCH_SWEEP_ITERS, &fe);
+
+            return fe.get(SWEEPS);
+        }, "sweep", name, nVars, "ns/sweep", results);
+    }
+
+    if (nVars <= BENCH_SOLVE_MAX_VARS) {
+        measure(bench, [&]() -> unsigned long long {
+            h.hooke(nVars, startPt, &endPt[0], rho, EPSMIN, IMAX, &fe);
+
+            return 1;
+        }, "solve", name, nVars, "ns/solve", results);
+    }
+}
+
+// Main program function main() :-).
+int main(int argc, char **argv) {
+    int arg;
+
+    unsigned int d;
+    unsigned int i;
+    unsigned int warmup = MICRO_WARMUP;
+    unsigned int reps   = MICRO_REPS;
+
+    const char *value;
+    const char *json  = NULL;
+    const char *label = "";
+
+    std::vector<MicroResult> results;
+
+    for (arg = 1; arg < argc; arg++) {
+        if ((value = optionValue(argv[arg], "--warmup")) != NULL) {
+            warmup = std::strtoul(value, NULL, 10);
+        } else if (((value = optionValue(argv[arg], "--reps")) != NULL)
+                && (std::strtoul(value, NULL, 10) > 0)) {
+
+            reps = std::strtoul(value, NULL, 10);
+        } else if ((value = optionValue(argv[arg], "--json")) != NULL) {
+            json = value;
+        } else if ((value = optionValue(argv[arg], "--label")) != NULL) {
+            label = value;
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--warmup=REPS]"
+                      << " [--reps=REPS] [--json=FILE] [--label=TEXT]\n";
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    MicroBench bench(warmup, reps);
+
+    std::cout << "  metric        func        n       batch"
+                 "       min ns    median ns       p90 ns       max ns\n";
+
+    for (d = 0; d < BENCH_N_DIMS; d++) {
+        std::vector<double> startPt(BENCH_DIMS[d]);
+
+        for (i = 0; i < BENCH_DIMS[d]; i++) {
+            startPt[i] = (i % 2 == 0) ? MINUS_ONE_POINT_TWO : ONE_POINT_ZERO;
+        }
+
+        hotPath<Rosenbrock>(bench, "rosenbrock", BENCH_DIMS[d],
+                            &startPt[0], RHO_BEGIN, results);
+
+        if (BENCH_DIMS[d] < Woods::NVARS) {
+            continue;
+        }
+
+        for (i = 0; i < BENCH_DIMS[d]; i++) {
+            startPt[i] = (i % 2 == 0) ? MINUS_THREE : MINUS_ONE;
+        }
+
+        hotPath<Woods>(bench, "woods", BENCH_DIMS[d], &startPt[0],
+                       RHO_WOODS, results);
+    }
+
+    if (json != NULL) {
+        std::ofstream out(json);
+
+        writeJson(out, label, bench, results);
+
+        if (!out) {
+            std::cerr << argv[0] << ": cannot write " << json << "\n";
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+// vim:set nu et ts=4 sw=4:
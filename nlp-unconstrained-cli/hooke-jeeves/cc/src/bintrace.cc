@@ -0,0 +1,114 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/bintrace.cc
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#include <cstring>
+
+#include "bintrace.h"
+
+// The NLPUCCLIHooke namespace.
+namespace NLPUCCLIHooke {
+
+// Helper method write(...).
+void BinaryTrace::write(const BinTraceEvent event,
+                        const unsigned int iters,
+                        const unsigned long long funEvals,
+                        const double f,
+                        const double *x,
+                        const unsigned int n) {
+
+    BinTraceRecord r;
+
+    unsigned int m = (n < nVars) ? n : nVars;
+
+    r.event    = event;
+    r.iters    = iters;
+    r.funEvals = funEvals;
+    r.f        = f;
+
+    std::memcpy(&record[0], &r, sizeof(r));
+    std::memcpy(&record[sizeof(r)], x, m * sizeof(double));
+
+    if (m < nVars) {
+        std::memset(&record[sizeof(r) + m * sizeof(double)], 0,
+                    (nVars - m) * sizeof(double));
+    }
+
+    getOut().write(&record[0], record.size());
+}
+
+// Writes the state at the start of an iteration.
+void BinaryTrace::iteration(const unsigned int iters,
+                            const unsigned long long funEvals,
+                            const double f,
+                            const double *x,
+                            const unsigned int n) {
+
+    write(BIN_TRACE_ITERATION, iters, funEvals, f, x, n);
+}
+
+// Writes the end of a solve.
+void BinaryTrace::summary(const unsigned int iters,
+                          const unsigned long long funEvals,
+                          const double f,
+                          const double *x,
+                          const unsigned int n) {
+
+    if ((getLevel() != TRACE_SUMMARY) && (getLevel() != TRACE_EVERY)) {
+        return;
+    }
+
+    write(BIN_TRACE_SUMMARY, iters, funEvals, f, x, n);
+}
+
+// Constructor.
+BinaryTrace::BinaryTrace(std::ostream &__out,
+                         const unsigned int __nVars,
+                         const double __rho,
+                         const double __epsilon,
+                         const TraceLevel __level,
+                         const unsigned int __every)
+    : Trace(__out, __level, TRACE_TEXT, __every),
+      nVars(__nVars),
+      record(sizeof(BinTraceRecord) + __nVars * sizeof(double)) {
+
+    BinTraceHeader h;
+
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic, BIN_TRACE_MAGIC, BIN_TRACE_MAGIC_SIZE);
+
+    h.version    = BIN_TRACE_VERSION;
+    h.solver     = BIN_TRACE_HOOKE;
+    h.nVars      = nVars;
+    h.recordSize = record.size();
+    h.rho        = __rho;
+    h.epsilon    = __epsilon;
+
+    getOut().write((const char *) &h, sizeof(h));
+}
+
+// Destructor.
+BinaryTrace::~BinaryTrace() {}
+
+} // namespace NLPUCCLIHooke
+
+// vim:set nu et ts=4 sw=4:
@@ -0,0 +1,236 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/bintrace.h
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#ifndef __CC__BINTRACE_H
+#define __CC__BINTRACE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "trace.h"
+
+/**
+ * The <code>NLPUCCLIHooke</code> namespace is used as a container
+ * for the <code>BinaryTrace</code> class.
+ */
+namespace NLPUCCLIHooke {
+
+/** Constant. The magic bytes a binary trace file starts with. */
+const char BIN_TRACE_MAGIC[] = "NLPT";
+
+/** Constant. The number of the magic bytes. */
+const unsigned int BIN_TRACE_MAGIC_SIZE = 4;
+
+/** Constant. The binary trace format version. */
+const std::uint16_t BIN_TRACE_VERSION = 1;
+
+/** Constant. The size of a binary trace file stream buffer (1 MiB). */
+const unsigned int BIN_TRACE_BUFFER_SIZE = 1 << 20;
+
+/** The solver that has written a binary trace. */
+enum BinTraceSolver {
+    /** The Hooke and Jeeves algorithm. */
+    BIN_TRACE_HOOKE = 1,
+
+    /** The Nelder-Mead simplex algorithm. */
+    BIN_TRACE_NELMIN = 2
+};
+
+/** The binary trace record kinds. */
+enum BinTraceEvent {
+    /** The state at the start of an iteration. */
+    BIN_TRACE_ITERATION = 0,
+
+    /** The end of a solve. */
+    BIN_TRACE_SUMMARY = 1
+};
+
+/**
+ * The binary trace file header (32 bytes, no padding).
+ * <br />
+ * <br />All the fields are in the byte order of the machine
+ * that has written the file.
+ */
+struct BinTraceHeader {
+    /** The magic bytes (<code>BIN_TRACE_MAGIC</code>). */
+    char magic[BIN_TRACE_MAGIC_SIZE];
+
+    /** The format version (<code>BIN_TRACE_VERSION</code>). */
+    std::uint16_t version;
+
+    /** The solver (a <code>BinTraceSolver</code>). */
+    std::uint16_t solver;
+
+    /** The number of coordinates of every record. */
+    std::uint32_t nVars;
+
+    /** The size of a record in bytes. */
+    std::uint32_t recordSize;
+
+    /** The rho value (0 for the Nelder-Mead solver). */
+    double rho;
+
+    /** The epsilon value (the <code>reqmin</code> one of Nelder-Mead). */
+    double epsilon;
+};
+
+/**
+ * The fixed part of a binary trace record (24 bytes, no padding);
+ * the <code>nVars</code> coordinates of the point follow it.
+ */
+struct BinTraceRecord {
+    /** The record kind (a <code>BinTraceEvent</code>). */
+    std::uint32_t event;
+
+    /** The iteration number. */
+    std::uint32_t iters;
+
+    /** The number of function evaluations so far. */
+    std::uint64_t funEvals;
+
+    /** The objective function value at the point. */
+    double f;
+};
+
+// The C writer (hooke-jeeves/c/src/bintrace.h) declares the same layout
+// on its own, so both sides check it.
+static_assert(sizeof(BinTraceHeader) == 32,
+              "The binary trace header has to be 32 bytes.");
+static_assert(offsetof(BinTraceHeader, nVars) == 8,
+              "The binary trace header has to be packed.");
+static_assert(offsetof(BinTraceHeader, rho) == 16,
+              "The binary trace header has to be packed.");
+static_assert(sizeof(BinTraceRecord) == 24,
+              "The binary trace record has to be 24 bytes.");
+static_assert(offsetof(BinTraceRecord, funEvals) == 8,
+              "The binary trace record has to be packed.");
+
+/**
+ * The <code>BinaryTrace</code> class is a trace that writes its records
+ * as packed fixed-width binary ones.
+ * <br />
+ * <br />The file starts with a <code>BinTraceHeader</code>; each record
+ * is then a <code>BinTraceRecord</code> followed by the point,
+ * so a record takes 24 + 8 * nVars bytes instead of the ~15 * nVars + 50
+ * of the text layout, and nothing gets formatted while solving.
+ * The values are kept bit-exact. The <code>hooke-tracedump</code> tool
+ * turns a file back into the text layout or into CSV.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @see     Trace
+ * @since   hooke-jeeves 0.1
+ */
+class BinaryTrace : public Trace {
+private:
+    /** The number of coordinates of every record. */
+    unsigned int nVars;
+
+    /** The record being put together. */
+    std::vector<char> record;
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Writes one record.
+     *
+     * @param event    The record kind.
+     * @param iters    The iteration number.
+     * @param funEvals The number of function evaluations so far.
+     * @param f        The objective function value at the point.
+     * @param x        The point.
+     * @param n        The number of coordinates of <code>x</code>
+     *                 (the missing ones up to <code>nVars</code>
+     *                 are written as zeroes, the extra ones are cut).
+     */
+    void write(const BinTraceEvent,
+               const unsigned int,
+               const unsigned long long,
+               const double,
+               const double *,
+               const unsigned int);
+
+    /** Copying is not allowed. */
+    BinaryTrace(const BinaryTrace &);
+    BinaryTrace &operator=(const BinaryTrace &);
+
+public:
+    /**
+     * Writes the state at the start of an iteration.
+     *
+     * @param iters    The iteration number.
+     * @param funEvals The number of function evaluations so far.
+     * @param f        The objective function value at the base point.
+     * @param x        The base point.
+     * @param n        The number of coordinates of <code>x</code>.
+     */
+    virtual void iteration(const unsigned int,
+                           const unsigned long long,
+                           const double,
+                           const double *,
+                           const unsigned int);
+
+    /**
+     * Writes the end of a solve (at <code>TRACE_SUMMARY</code>
+     * and <code>TRACE_EVERY</code>).
+     *
+     * @param iters    The number of iterations used.
+     * @param funEvals The number of function evaluations used.
+     * @param f        The objective function value at the ending point.
+     * @param x        The ending point.
+     * @param n        The number of coordinates of <code>x</code>.
+     */
+    virtual void summary(const unsigned int,
+                         const unsigned long long,
+                         const double,
+                         const double *,
+                         const unsigned int);
+
+    /**
+     * Constructor. Writes the file header.
+     *
+     * @param __out     The stream to write the records to (opened
+     *                  in the binary mode).
+     * @param __nVars   The number of coordinates of every record.
+     * @param __rho     The rho value.
+     * @param __epsilon The epsilon value.
+     * @param __level   The amount of the progress to report.
+     * @param __every   The iteration step of <code>TRACE_EVERY</code>.
+     */
+    BinaryTrace(std::ostream &,
+                const unsigned int,
+                const double,
+                const double,
+                const TraceLevel = TRACE_FULL,
+                const unsigned int = 1);
+
+    /** Destructor. */
+    virtual ~BinaryTrace();
+};
+
+} // namespace NLPUCCLIHooke
+
+#endif // __CC__BINTRACE_H
+
+// vim:set nu et ts=4 sw=4:
@@ -0,0 +1,183 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/dimsweep.cc
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#include <chrono>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include "rosenbrock.h"
+#include "woods.h"
+#include "hooke.h"
+
+using namespace NLPUCCLIHooke;
+
+// Helper constants.
+const unsigned int SWEEP_ITER_MAX    = 3;
+const double       SWEEP_MIN_SECONDS = .1;
+const unsigned int SWEEP_DIMS[]      = {
+    2, 4, 16, 128, 1024, 10000, 100000, 1000000
+};
+const unsigned int SWEEP_N_DIMS = sizeof(SWEEP_DIMS) / sizeof(SWEEP_DIMS[0]);
+const unsigned int KIB          = 1024;
+
+// Helper variable (the results of the timed calls are stored away here).
+static volatile double sink;
+
+/** The signature of the single-point objective functions. */
+typedef double (*Kernel)(const double *, const unsigned int, FunEvals *);
+
+/**
+ * Helper function.
+ * <br />
+ * <br />Measures the throughput of a single-point objective function:
+ * evaluates it over and over, doubling the number of calls until they
+ * take <code>SWEEP_MIN_SECONDS</code> at least.
+ *
+ * @param kernel The objective function.
+ * @param x      The point.
+ * @param n      The number of coordinates of <code>x</code>.
+ *
+ * @return The number of evaluations per second.
+ */
+static double rate(const Kernel kernel,
+                   const double *x,
+                   const unsigned int n) {
+
+    unsigned long long c;
+    unsigned long long calls;
+
+    std::chrono::duration<double> t;
+
+    FunEvals fe;
+
+    for (calls = 1; ; calls *= 2) {
+        std::chrono::steady_clock::time_point t0
+            = std::chrono::steady_clock::now();
+
+        for (c = 0; c < calls; c++) {
+            sink = kernel(x, n, &fe);
+
+            // The point might have changed: no call can be hoisted.
+            __asm__ __volatile__("" : : "g"(x) : "memory");
+        }
+
+        t = std::chrono::steady_clock::now() - t0;
+
+        if (t.count() >= SWEEP_MIN_SECONDS) {
+            break;
+        }
+    }
+
+    return (calls / t.count());
+}
+
+/**
+ * Helper function.
+ * <br />
+ * <br />Prints one row of the sweep: the evaluation throughput
+ * of the scalar and the vector kernels, the one of a short solve
+ * (<code>SWEEP_ITER_MAX</code> iterations, incremental), the size
+ * of the solver's work arrays and the peak resident set so far.
+ *
+ * @param name    The problem name.
+ * @param nVars   The number of variables.
+ * @param startPt The starting point coordinates.
+ * @param rho     The rho value.
+ */
+template<typename Objective>
+static void sweep(const char *name,
+                  const unsigned int nVars,
+                  const double *startPt,
+                  const double rho) {
+
+    double fScalar = rate(&Objective::fScalar, startPt, nVars);
+    double fVector = rate(&Objective::fVector, startPt, nVars);
+
+    std::vector<double> endPt(nVars);
+
+    struct rusage usage;
+
+    FunEvals fe;
+
+    Hooke<Objective> h;
+    Workspace ws(nVars);
+
+    h.setTrace(false);
+    h.setIncremental(true);
+    h.setWorkspace(&ws);
+
+    std::chrono::steady_clock::time_point t0
+        = std::chrono::steady_clock::now();
+
+    h.hooke(nVars, startPt, &endPt[0], rho, EPSMIN, SWEEP_ITER_MAX, &fe);
+
+    std::chrono::duration<double> t = std::chrono::steady_clock::now() - t0;
+
+    getrusage(RUSAGE_SELF, &usage);
+
+    std::cout << std::setw(10) << name << std::setw(9) << nVars
+              << std::scientific << std::setprecision(3)
+              << std::setw(13) << fScalar << std::setw(13) << fVector
+              << std::fixed << std::setprecision(2)
+              << std::setw(9) << (fVector / fScalar)
+              << std::scientific << std::setprecision(3)
+              << std::setw(13) << (fe.getFunEvals() / t.count())
+              << std::setw(11)
+              << ((ws.getSize() + 2 * nVars * sizeof(double)) / KIB)
+              << std::setw(11) << usage.ru_maxrss << "\n";
+}
+
+// Main program function main() :-).
+int main() {
+    unsigned int d;
+    unsigned int i;
+
+    std::cout << "      func        n   scalar f/s   vector f/s  speedup"
+                 "    solve f/s   work KiB   peak KiB\n";
+
+    for (d = 0; d < SWEEP_N_DIMS; d++) {
+        std::vector<double> startPt(SWEEP_DIMS[d]);
+
+        for (i = 0; i < SWEEP_DIMS[d]; i++) {
+            startPt[i] = (i % 2 == 0) ? MINUS_ONE_POINT_TWO : ONE_POINT_ZERO;
+        }
+
+        sweep<Rosenbrock>("rosenbrock", SWEEP_DIMS[d], &startPt[0],
+                          RHO_BEGIN);
+
+        if (SWEEP_DIMS[d] < Woods::NVARS) {
+            continue;
+        }
+
+        for (i = 0; i < SWEEP_DIMS[d]; i++) {
+            startPt[i] = (i % 2 == 0) ? MINUS_THREE : MINUS_ONE;
+        }
+
+        sweep<Woods>("woods", SWEEP_DIMS[d], &startPt[0], RHO_WOODS);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+// vim:set nu et ts=4 sw=4:
@@ -0,0 +1,122 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/evalcache.cc
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include "evalcache.h"
+
+// The NLPUCCLIHooke namespace.
+namespace NLPUCCLIHooke {
+
+// Helper constants (the 64-bit FNV-1a offset basis and a mixing prime).
+const unsigned long long HASH_BASIS = 0xcbf29ce484222325ULL;
+const unsigned long long HASH_PRIME = 0x100000001b3ULL;
+const unsigned long long HASH_MIX   = 0x9e3779b97f4a7c15ULL;
+const unsigned int       HASH_SHIFT = 32;
+
+// Helper method setOf(...).
+unsigned int EvalCache::setOf(const double *x) const {
+    unsigned long long h = HASH_BASIS;
+    unsigned long long bits;
+
+    unsigned int i;
+
+    // One multiply per coordinate: the whole 64-bit pattern goes in.
+    for (i = 0; i < nVars; i++) {
+        std::memcpy(&bits, &x[i], sizeof(bits));
+
+        h = (h ^ bits) * HASH_PRIME;
+    }
+
+    h *= HASH_MIX;
+
+    return ((unsigned int) (h >> HASH_SHIFT)) & (nSets - 1);
+}
+
+// Looks a point up.
+bool EvalCache::lookup(const double *x, double *f) {
+    unsigned int w;
+    unsigned int slot = setOf(x) * CACHE_WAYS;
+
+    for (w = slot; w < slot + CACHE_WAYS; w++) {
+        if ((stamps[w] != 0)
+            && (std::memcmp(&keys[w * nVars], x, nVars * sizeof(double))
+                == 0)) {
+
+            stamps[w] = ++clock;
+            *f        = values[w];
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Stores the objective function value at a point.
+void EvalCache::insert(const double *x, const double f) {
+    unsigned int w;
+    unsigned int slot   = setOf(x) * CACHE_WAYS;
+    unsigned int victim = slot;
+
+    // An empty slot has the zero stamp, so it is always the LRU one.
+    for (w = slot + 1; w < slot + CACHE_WAYS; w++) {
+        if (stamps[w] < stamps[victim]) {
+            victim = w;
+        }
+    }
+
+    std::memcpy(&keys[victim * nVars], x, nVars * sizeof(double));
+
+    values[victim] = f;
+    stamps[victim] = ++clock;
+}
+
+// Drops all the entries.
+void EvalCache::clear() {
+    std::fill(stamps.begin(), stamps.end(), 0ULL);
+
+    clock = 0;
+}
+
+// Constructor.
+EvalCache::EvalCache(const unsigned int __nVars,
+                     const unsigned int __capacity)
+    : nVars(__nVars), nSets(1), clock(0) {
+
+    while (nSets * CACHE_WAYS < __capacity) {
+        nSets <<= 1;
+    }
+
+    keys.resize(nSets * CACHE_WAYS * nVars);
+    values.resize(nSets * CACHE_WAYS);
+    stamps.resize(nSets * CACHE_WAYS, 0ULL);
+}
+
+// Destructor.
+EvalCache::~EvalCache() {}
+
+} // namespace NLPUCCLIHooke
+
+// vim:set nu et ts=4 sw=4:
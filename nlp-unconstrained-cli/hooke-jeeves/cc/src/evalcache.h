@@ -0,0 +1,124 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/evalcache.h
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#ifndef __CC__EVALCACHE_H
+#define __CC__EVALCACHE_H
+
+#include <vector>
+
+/**
+ * The <code>NLPUCCLIHooke</code> namespace is used as a container
+ * for the <code>EvalCache</code> class.
+ */
+namespace NLPUCCLIHooke {
+
+/** Constant. The number of entries (ways) per cache set. */
+const unsigned int CACHE_WAYS = 4;
+
+/**
+ * The <code>EvalCache</code> class is a bounded memoization cache
+ * of the objective function values.
+ * <br />
+ * <br />It is an open-addressed, set-associative table keyed
+ * on the exact bit pattern of the point: a point hashes to a set
+ * of <code>CACHE_WAYS</code> slots, and when the set is full,
+ * its least recently used entry is evicted. All the storage is
+ * allocated once, at construction.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @see     Hooke
+ * @since   hooke-jeeves 0.1
+ */
+class EvalCache {
+private:
+    /** The number of coordinates of a point (the key length). */
+    unsigned int nVars;
+
+    /** The number of sets (a power of two). */
+    unsigned int nSets;
+
+    /** The keys: <code>nSets * CACHE_WAYS</code> rows of nVars. */
+    std::vector<double> keys;
+
+    /** The cached objective function values. */
+    std::vector<double> values;
+
+    /** The last-use time of each slot (0 marks an empty slot). */
+    std::vector<unsigned long long> stamps;
+
+    /** The use-time counter. */
+    unsigned long long clock;
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Hashes the bit pattern of a point into a set index.
+     *
+     * @param x The point.
+     *
+     * @return The index of the set.
+     */
+    unsigned int setOf(const double *) const;
+
+public:
+    /**
+     * Looks a point up.
+     *
+     * @param x The point.
+     * @param f The cached objective function value (output).
+     *
+     * @return <code>true</code> on a hit.
+     */
+    bool lookup(const double *, double *);
+
+    /**
+     * Stores the objective function value at a point,
+     * evicting the least recently used entry of its set if needed.
+     *
+     * @param x The point.
+     * @param f The objective function value.
+     */
+    void insert(const double *, const double);
+
+    /** Drops all the entries. */
+    void clear();
+
+    /**
+     * Constructor.
+     *
+     * @param __nVars    The number of coordinates of a point.
+     * @param __capacity The maximum number of entries (rounded up
+     *                   to a power-of-two number of sets).
+     */
+    EvalCache(const unsigned int, const unsigned int);
+
+    /** Destructor. */
+    ~EvalCache();
+};
+
+} // namespace NLPUCCLIHooke
+
+#endif // __CC__EVALCACHE_H
+
+// vim:set nu et ts=4 sw=4:
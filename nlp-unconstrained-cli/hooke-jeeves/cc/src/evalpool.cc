@@ -0,0 +1,307 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/evalpool.cc
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "evalpool.h"
+
+// The NLPUCCLIHooke namespace.
+namespace NLPUCCLIHooke {
+
+// Helper constant (the value of an evaluation which has failed: no point
+// looks better than another one, so the solve shrinks its steps and ends
+// as at a local minimum; a NaN would run it to the iteration limit).
+const double EVAL_FAILED = std::numeric_limits<double>::infinity();
+
+// Helper method checkOut(...).
+unsigned int EvalPool::checkOut(const unsigned int max, unsigned int *out) {
+    unsigned int count = 0;
+
+    std::unique_lock<std::mutex> guard(lock);
+
+    while (idle.empty() && !broken) {
+        available.wait(guard);
+    }
+
+    if (broken) {
+        return 0;
+    }
+
+    while ((count < max) && !idle.empty()) {
+        out[count++] = idle.back();
+
+        idle.pop_back();
+    }
+
+    return count;
+}
+
+// Helper method checkIn(...).
+void EvalPool::checkIn(const unsigned int *in,
+                       const unsigned int count,
+                       const bool failed) {
+
+    unsigned int c;
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+
+        for (c = 0; c < count; c++) {
+            workers[in[c]].outstanding = 0;
+
+            idle.push_back(in[c]);
+        }
+
+        if (failed) {
+            broken = true;
+        }
+    }
+
+    available.notify_all();
+}
+
+// Helper method send(...).
+bool EvalPool::send(Worker &w,
+                    const std::uint32_t tag,
+                    const double *x,
+                    const unsigned int n,
+                    const unsigned int m) {
+
+    return (eval_send_request(w.fd, tag, x, n, m, &w.frame, &w.frameSize)
+            != 0);
+}
+
+// Helper method receive(...).
+bool EvalPool::receive(Worker &w, eval_reply &reply) {
+    return (eval_receive_reply(w.fd, &reply) != 0);
+}
+
+// Getter for the number of the workers running.
+unsigned int EvalPool::size() const {
+    return workers.size();
+}
+
+// Tells whether a worker has failed (or has not started).
+bool EvalPool::failed() {
+    std::lock_guard<std::mutex> guard(lock);
+
+    return broken;
+}
+
+// Evaluates f(x) at one point.
+double EvalPool::eval(const double *x, const unsigned int n) {
+    unsigned int w;
+
+    bool ok;
+
+    eval_reply reply;
+
+    if (checkOut(1, &w) == 0) {
+        return EVAL_FAILED;
+    }
+
+    ok = send(workers[w], 0, x, n, 1) && receive(workers[w], reply)
+      && (reply.tag == 0);
+
+    checkIn(&w, 1, !ok);
+
+    return (ok ? reply.f : EVAL_FAILED);
+}
+
+// Evaluates f(x) at m points, pipelined across the idle workers.
+void EvalPool::evalBatch(const double *x,
+                         const unsigned int n,
+                         const unsigned int m,
+                         double *f) {
+
+    unsigned int c;
+    unsigned int k;
+    unsigned int next = 0;
+    unsigned int done = 0;
+
+    bool ok = true;
+
+    eval_reply reply;
+
+    std::vector<unsigned int> out(workers.size());
+    std::vector<pollfd>       fds(workers.size());
+
+    unsigned int count = checkOut(out.size(), &out[0]);
+
+    if (count == 0) {
+        ok = false;
+    }
+
+    while (ok && (done < m)) {
+        // Topping every worker up to depth outstanding requests.
+        for (c = 0; ok && (c < count); c++) {
+            Worker &w = workers[out[c]];
+
+            while (ok && (w.outstanding < depth) && (next < m)) {
+                ok = send(w, next, x + next, n, m);
+
+                w.outstanding++;
+                next++;
+            }
+
+            fds[c].fd      = w.fd;
+            fds[c].events  = (w.outstanding > 0) ? POLLIN : 0;
+            fds[c].revents = 0;
+        }
+
+        if (!ok) {
+            break;
+        }
+
+        if (poll(&fds[0], count, -1) < 0) {
+            ok = (errno == EINTR);
+
+            continue;
+        }
+
+        for (c = 0; ok && (c < count); c++) {
+            if (fds[c].revents == 0) {
+                continue;
+            }
+
+            ok = receive(workers[out[c]], reply) && (reply.tag < m);
+
+            if (ok) {
+                f[reply.tag] = reply.f;
+
+                workers[out[c]].outstanding--;
+
+                done++;
+            }
+        }
+    }
+
+    if (!ok) {
+        for (k = 0; k < m; k++) {
+            f[k] = EVAL_FAILED;
+        }
+    }
+
+    checkIn(&out[0], count, !ok);
+}
+
+// Constructor.
+EvalPool::EvalPool(const char *__command,
+                   const char *__problem,
+                   const unsigned int __nWorkers,
+                   const unsigned int __depth)
+    : depth((__depth == 0) ? 1 : __depth),
+      broken(false) {
+
+    unsigned int k;
+    unsigned int nWorkers = (__nWorkers == 0) ? 1 : __nWorkers;
+
+    Worker w;
+
+    // Nothing buffered must get written by the workers again.
+    std::cout.flush();
+    std::fflush(stdout);
+
+    for (k = 0; k < nWorkers; k++) {
+        if ((w.fd = eval_spawn(__command, __problem, &w.pid)) < 0) {
+            broken = true;
+
+            break;
+        }
+
+        w.outstanding = 0;
+        w.frame       = NULL;
+        w.frameSize   = 0;
+
+        workers.push_back(w);
+        idle.push_back(k);
+    }
+
+    if (workers.empty()) {
+        broken = true;
+    }
+}
+
+// Destructor.
+EvalPool::~EvalPool() {
+    unsigned int k;
+
+    // The end of the input tells the workers to exit.
+    for (k = 0; k < workers.size(); k++) {
+        close(workers[k].fd);
+    }
+
+    for (k = 0; k < workers.size(); k++) {
+        waitpid(workers[k].pid, NULL, 0);
+
+        std::free(workers[k].frame);
+    }
+}
+
+// The pool the evaluations go to.
+EvalPool *RemoteObjective::pool = NULL;
+
+// Setter for the pool the evaluations go to.
+void RemoteObjective::setPool(EvalPool *__pool) {
+    pool = __pool;
+}
+
+// The objective function f(x,n).
+double RemoteObjective::f(const double *x,
+                          const unsigned int n,
+                          FunEvals *funEvals) {
+
+    funEvals->add(FUN_EVALS);
+
+    return pool->eval(x, n);
+}
+
+// The batch objective function.
+void RemoteObjective::fBatch(const double *x,
+                             const unsigned int n,
+                             const unsigned int m,
+                             double *f,
+                             FunEvals *funEvals) {
+
+    funEvals->add(FUN_EVALS, m);
+
+    pool->evalBatch(x, n, m, f);
+}
+
+// Default constructor.
+RemoteObjective::RemoteObjective() {}
+
+// Destructor.
+RemoteObjective::~RemoteObjective() {}
+
+} // namespace NLPUCCLIHooke
+
+// vim:set nu et ts=4 sw=4:
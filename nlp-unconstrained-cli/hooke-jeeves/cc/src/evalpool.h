@@ -0,0 +1,295 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/evalpool.h
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#ifndef __CC__EVALPOOL_H
+#define __CC__EVALPOOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <sys/types.h>
+
+#include "funevals.h"
+
+/*
+ * The evaluation worker protocol: a C module, shared with the Nelder-Mead
+ * C tree, so the pools and the workers of either tree speak the one
+ * protocol.
+ */
+#include "../../c/src/evalwire.h"
+
+/**
+ * The <code>NLPUCCLIHooke</code> namespace is used as a container
+ * for the <code>EvalPool</code> and <code>RemoteObjective</code> classes.
+ * <br />
+ * <br />The evaluation protocol: a worker is a long-lived process which
+ * answers the requests of its standard input on its standard output
+ * (see <code>evalwire.h</code>).
+ */
+namespace NLPUCCLIHooke {
+
+/** Constant. The default number of the outstanding requests per worker. */
+const unsigned int EVAL_DEPTH = 8;
+
+/**
+ * The <code>EvalPool</code> class keeps a pool of worker processes
+ * evaluating an objective function out of process.
+ * <br />
+ * <br />A single evaluation checks an idle worker out, waits for its
+ * reply and checks it back in, so that as many threads as there are
+ * workers get served at once. A batch keeps up to <code>depth</code>
+ * requests outstanding on every idle worker, reading the replies
+ * as they come in. Once a worker fails (dies or talks nonsense)
+ * the pool is failed: every evaluation from then on gets +inf,
+ * which ends the solves in a few iterations.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @see     RemoteObjective
+ * @since   hooke-jeeves 0.1
+ */
+class EvalPool {
+private:
+    /** A worker process. */
+    struct Worker {
+        /** The process id. */
+        pid_t pid;
+
+        /** The socket to the process. */
+        int fd;
+
+        /** The number of the outstanding requests. */
+        unsigned int outstanding;
+
+        /** The request frame (built in place, see <code>send()</code>). */
+        char *frame;
+
+        /** The size of the request frame. */
+        std::size_t frameSize;
+    };
+
+    /** The workers. */
+    std::vector<Worker> workers;
+
+    /** The indices of the idle workers. */
+    std::vector<unsigned int> idle;
+
+    /** The number of the outstanding requests per worker of a batch. */
+    unsigned int depth;
+
+    /** Whether a worker has failed (or has not started). */
+    bool broken;
+
+    /** The lock guarding the idle workers and the failure flag. */
+    std::mutex lock;
+
+    /** Signalled when a worker gets checked back in. */
+    std::condition_variable available;
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Checks idle workers out, waiting for one if there is none.
+     *
+     * @param max The maximum number of workers to check out.
+     * @param out The indices of the workers checked out (output, max).
+     *
+     * @return The number of workers checked out (none if the pool
+     *         is failed).
+     */
+    unsigned int checkOut(const unsigned int, unsigned int *);
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Checks workers back in.
+     *
+     * @param in     The indices of the workers.
+     * @param count  The number of workers.
+     * @param failed Whether one of them has failed.
+     */
+    void checkIn(const unsigned int *, const unsigned int, const bool);
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Sends a request to a worker.
+     *
+     * @param w   The worker.
+     * @param tag The tag of the request.
+     * @param x   The point (coordinate i at <code>x[i * m]</code>).
+     * @param n   The number of coordinates of the point.
+     * @param m   The stride of the coordinates.
+     *
+     * @return <code>false</code> if the worker has failed.
+     */
+    bool send(Worker &,
+              const std::uint32_t,
+              const double *,
+              const unsigned int,
+              const unsigned int);
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Receives a reply from a worker.
+     *
+     * @param w     The worker.
+     * @param reply The reply (output).
+     *
+     * @return <code>false</code> if the worker has failed.
+     */
+    bool receive(Worker &, eval_reply &);
+
+    /** Copying is not allowed. */
+    EvalPool(const EvalPool &);
+    EvalPool &operator=(const EvalPool &);
+
+public:
+    /**
+     * Getter for the number of the workers running.
+     *
+     * @return The number of workers.
+     */
+    unsigned int size() const;
+
+    /**
+     * Tells whether a worker has failed (or has not started).
+     *
+     * @return <code>true</code> if the pool is failed.
+     */
+    bool failed();
+
+    /**
+     * Evaluates f(x) at one point.
+     *
+     * @param x The point.
+     * @param n The number of coordinates of <code>x</code>.
+     *
+     * @return The objective function value (+inf if the pool is failed).
+     */
+    double eval(const double *, const unsigned int);
+
+    /**
+     * Evaluates f(x) at m points, pipelined across the idle workers.
+     *
+     * @param x The points (coordinate i of point k
+     *          at <code>x[i * m + k]</code>).
+     * @param n The number of coordinates of a point.
+     * @param m The number of points.
+     * @param f The objective function values (output, m; +inf
+     *          if the pool is failed).
+     */
+    void evalBatch(const double *,
+                   const unsigned int,
+                   const unsigned int,
+                   double *);
+
+    /**
+     * Constructor.
+     * <br />
+     * <br />Starts the workers: the words of the command (split
+     * at the spaces), then the problem name.
+     *
+     * @param command  The worker command.
+     * @param problem  The problem name.
+     * @param nWorkers The number of workers (at least one is started).
+     * @param depth    The number of the outstanding requests per worker
+     *                 of a batch.
+     */
+    EvalPool(const char *,
+             const char *,
+             const unsigned int,
+             const unsigned int = EVAL_DEPTH);
+
+    /** Destructor. Closes the sockets and waits for the workers. */
+    ~EvalPool();
+};
+
+/**
+ * The <code>RemoteObjective</code> class is the objective function
+ * provider (see <code>objective.h</code>) evaluating through
+ * an <code>EvalPool</code>: the plain <code>f()</code> makes a round trip
+ * to one worker, the batch <code>fBatch()</code> (called e.g. by the
+ * SIMD lanes of the multi-start mode) keeps many requests in flight.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @see     EvalPool
+ * @since   hooke-jeeves 0.1
+ */
+class RemoteObjective {
+private:
+    /** The pool the evaluations go to. */
+    static EvalPool *pool;
+
+public:
+    /**
+     * Setter for the pool the evaluations go to.
+     *
+     * @param __pool The pool.
+     */
+    static void setPool(EvalPool *);
+
+    /**
+     * The objective function f(x,n).
+     *
+     * @param x         The point at which f(x) should be evaluated.
+     * @param n         The number of coordinates of <code>x</code>.
+     * @param funEvals  The number of function evaluations counter.
+     *
+     * @return The objective function value.
+     */
+    static double f(const double *, const unsigned int, FunEvals *);
+
+    /**
+     * The batch objective function.
+     *
+     * @param x         The points (coordinate i of point k
+     *                  at <code>x[i * m + k]</code>).
+     * @param n         The number of coordinates of a point.
+     * @param m         The number of points.
+     * @param f         The objective function values (output, m).
+     * @param funEvals  The number of function evaluations counter.
+     */
+    static void fBatch(const double *,
+                       const unsigned int,
+                       const unsigned int,
+                       double *,
+                       FunEvals *);
+
+    /** Default constructor. */
+    RemoteObjective();
+
+    /** Destructor. */
+    ~RemoteObjective();
+};
+
+} // namespace NLPUCCLIHooke
+
+#endif // __CC__EVALPOOL_H
+
+// vim:set nu et ts=4 sw=4:
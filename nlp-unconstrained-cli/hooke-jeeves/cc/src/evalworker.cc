@@ -0,0 +1,133 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/evalworker.cc
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#include <climits>
+#include <cstring>
+#include <iostream>
+
+#include "rosenbrock.h"
+#include "woods.h"
+#include "mgh.h"
+#include "evalpool.h"
+
+using namespace NLPUCCLIHooke;
+
+/**
+ * A problem the worker evaluates: the name and the objective function
+ * (see the problem registry in <code>hooke.cc</code>).
+ */
+struct EvalProblem {
+    /** The name the problem is selected by. */
+    const char *name;
+
+    /** The objective function f(x,n). */
+    double (*f)(const double *, const unsigned int, FunEvals *);
+};
+
+// Helper constant (the problems, the same names as the registry has).
+static const EvalProblem EVAL_PROBLEMS[] = {
+    {"rosenbrock",  &Rosenbrock::f},
+    {"woods",       &Woods::f},
+    {"helical",     &HelicalValley::f},
+    {"biggs",       &BiggsExp6::f},
+    {"gaussian",    &Gaussian::f},
+    {"powellbs",    &PowellBadlyScaled::f},
+    {"box",         &Box3D::f},
+    {"vardim",      &VariablyDimensioned::f},
+    {"watson",      &Watson::f},
+    {"penalty1",    &PenaltyI::f},
+    {"penalty2",    &PenaltyII::f},
+    {"brownbs",     &BrownBadlyScaled::f},
+    {"browndennis", &BrownDennis::f},
+    {"gulf",        &GulfResearch::f},
+    {"trig",        &Trigonometric::f},
+    {"powell",      &PowellSingular::f},
+    {"beale",       &Beale::f},
+    {"chebyquad",   &Chebyquad::f}
+};
+
+// Helper constant (the number of the problems).
+const unsigned int EVAL_N_PROBLEMS = sizeof(EVAL_PROBLEMS)
+                                   / sizeof(EVAL_PROBLEMS[0]);
+
+/**
+ * Helper function.
+ * <br />
+ * <br />Evaluates the problem the worker serves
+ * (see <code>eval_serve()</code>).
+ *
+ * @param x    The point.
+ * @param n    The number of coordinates of <code>x</code>.
+ * @param data The problem.
+ *
+ * @return The objective function value.
+ */
+static double evaluate(const double *x, const unsigned int n, void *data) {
+    // The counter the objective functions take (the pool does the counting).
+    static FunEvals fe;
+
+    return ((const EvalProblem *) data)->f(x, n, &fe);
+}
+
+/*
+ * Main program function main() :-).
+ * The stand-in evaluation worker: evaluates the requests one by one,
+ * optionally sleeping as long as a real simulator would take.
+ */
+int main(int argc, char **argv) {
+    int arg;
+
+    unsigned int k;
+    unsigned int delay = 0;
+
+    const char *value;
+    const char *name = NULL;
+
+    const EvalProblem *problem = NULL;
+
+    for (arg = 1; arg < argc; arg++) {
+        if (std::strncmp(argv[arg], "--delay-us=", 11) == 0) {
+            value = argv[arg] + 11;
+            delay = std::strtoul(value, NULL, 10);
+        } else {
+            name = argv[arg];
+        }
+    }
+
+    for (k = 0; (name != NULL) && (k < EVAL_N_PROBLEMS); k++) {
+        if (std::strcmp(EVAL_PROBLEMS[k].name, name) == 0) {
+            problem = &EVAL_PROBLEMS[k];
+        }
+    }
+
+    if (problem == NULL) {
+        std::cerr << "Usage: " << argv[0] << " [--delay-us=MICROSECONDS]"
+                  << " PROBLEM\n";
+
+        return EXIT_FAILURE;
+    }
+
+    return eval_serve(&evaluate, (void *) problem, 1, UINT_MAX, delay);
+}
+
+// vim:set nu et ts=4 sw=4:
@@ -21,23 +21,129 @@
  * (See the LICENSE file at the top of the source tree.)
  */
 
+#include <thread>
+
 #include "funevals.h"
 
 // The NLPUCCLIHooke namespace.
 namespace NLPUCCLIHooke {
 
-// Getter for funEvals.
-unsigned int FunEvals::getFunEvals() {
-    return funEvals;
+// Helper constants (the counters have to fit in a shard).
+static_assert(N_COUNTERS <= FUNEVALS_STRIDE, "too many counters");
+
+// The last unique id given out.
+std::atomic<unsigned long long> funEvalsLastId(0);
+
+// Helper function.
+// Gives out the id of the calling thread (once).
+static unsigned long long threadId() {
+    static thread_local unsigned long long id = 0;
+
+    if (id == 0) {
+        id = funEvalsLastId.fetch_add(1) + 1;
+    }
+
+    return id;
 }
 
-// Setter for funEvals.
-void FunEvals::setFunEvals(const unsigned int __funEvals) {
-    funEvals = __funEvals;
+// Helper method claim().
+unsigned int FunEvals::claim() {
+    unsigned long long me = threadId();
+    unsigned long long free;
+
+    unsigned int s;
+
+    // The thread may have counted here before (and elsewhere since).
+    for (s = 0; s < nShards; s++) {
+        if (owners[s].load(std::memory_order_relaxed) == me) {
+            return s;
+        }
+    }
+
+    for (s = 0; s < nShards; s++) {
+        free = 0;
+
+        if (owners[s].compare_exchange_strong(free, me)) {
+            return s;
+        }
+    }
+
+    return nShards;
+}
+
+// Helper method addShared(...).
+void FunEvals::addShared(const Counter counter,
+                         const unsigned long long count) {
+
+    LastShard &last = lastShard();
+
+    if (last.id != id) {
+        last.id    = id;
+        last.shard = claim();
+
+        if (last.shard < nShards) {
+            add(counter, count);
+
+            return;
+        }
+    }
+
+    shared[counter].fetch_add(count, std::memory_order_relaxed);
+}
+
+// Reads a counter, merging its shards.
+unsigned long long FunEvals::get(const Counter counter) const {
+    unsigned long long sum = shared[counter].load(std::memory_order_relaxed);
+
+    unsigned int s;
+
+    for (s = 0; s < nShards; s++) {
+        sum += shards[s * FUNEVALS_STRIDE + counter]
+               .load(std::memory_order_relaxed);
+    }
+
+    return sum;
+}
+
+// Zeroes all the counters.
+void FunEvals::reset() {
+    unsigned int s;
+    unsigned int c;
+
+    for (c = 0; c < N_COUNTERS; c++) {
+        for (s = 0; s < nShards; s++) {
+            shards[s * FUNEVALS_STRIDE + c].store(0,
+                                                  std::memory_order_relaxed);
+        }
+
+        shared[c].store(0, std::memory_order_relaxed);
+    }
+}
+
+// Helper function.
+// Tells the number of the per-thread shards of an instance.
+static unsigned int shardsWanted() {
+    // Asked once: it reads the system configuration.
+    static const unsigned int n = std::thread::hardware_concurrency() + 1;
+
+    return (n > FUNEVALS_SHARDS) ? n : FUNEVALS_SHARDS;
 }
 
 // Default constructor.
-FunEvals::FunEvals() {}
+FunEvals::FunEvals()
+    : id(funEvalsLastId.fetch_add(1) + 1),
+      nShards(shardsWanted()),
+      shards(nShards * FUNEVALS_STRIDE),
+      owners(nShards) {
+
+    unsigned int s;
+
+    for (s = 0; s < nShards; s++) {
+        owners[s].store(0, std::memory_order_relaxed);
+    }
+
+    reset();
+}
 
 // Destructor.
 FunEvals::~FunEvals() {}
@@ -24,16 +24,96 @@
 #ifndef __CC__FUNEVALS_H
 #define __CC__FUNEVALS_H
 
+#include <atomic>
+#include <vector>
+
 /**
  * The <code>NLPUCCLIHooke</code> namespace is used as a container
  * for the <code>FunEvals</code> class.
  */
 namespace NLPUCCLIHooke {
 
+/** The solver metrics counted by <code>FunEvals</code>. */
+enum Counter {
+    /** The number of (full) function evaluations. */
+    FUN_EVALS,
+
+    /** The number of wasted speculative function evaluations. */
+    WASTED_EVALS,
+
+    /** The number of early-aborted (rejected) function evaluations. */
+    REJECTED_EVALS,
+
+    /** The number of evaluation cache hits. */
+    CACHE_HITS,
+
+    /** The number of evaluation cache misses. */
+    CACHE_MISSES,
+
+    /** The number of exploratory sweeps. */
+    SWEEPS,
+
+    /**
+     * The number of bytes written to the work arrays by the vector
+     * copies, resets and pattern moves (not counting the probes).
+     */
+    BYTES_MOVED,
+
+    /** The number of coordinates moved by the exploratory moves. */
+    ACCEPTED_MOVES,
+
+    /** The number of coordinates left alone by the exploratory moves. */
+    REJECTED_MOVES,
+
+    /** The number of pattern moves. */
+    PATTERN_MOVES,
+
+    /** The number of the counters (not a counter itself). */
+    N_COUNTERS
+};
+
+/**
+ * Constant. The minimum number of per-thread counter shards
+ * of a <code>FunEvals</code> instance (there is one more per hardware
+ * thread beyond that).
+ */
+const unsigned int FUNEVALS_SHARDS = 16;
+
+/**
+ * Constant. The stride of the shards, in counters: two cache lines,
+ * so that no two shards ever share a line, however the instance
+ * happens to be aligned.
+ */
+const unsigned int FUNEVALS_STRIDE = 16;
+
+/**
+ * The last unique id given out (to a <code>FunEvals</code> instance
+ * or to a counting thread; 0 is never given out).
+ */
+extern std::atomic<unsigned long long> funEvalsLastId;
+
 /**
  * The <code>FunEvals</code> class is a helper class.
- * It holds the only property &ndash; the number of objective function
- * evaluations (and corresponding accessor methods).
+ * It holds the number of objective function evaluations,
+ * along with the other solver metrics (see <code>Counter</code>).
+ * <br />
+ * <br />The counters are sharded: every thread counts into a shard
+ * of its own, so that nothing is shared on the hot path, and the shards
+ * are merged on read. The shards belong to the instance: a thread claims
+ * one the first time it counts into the instance and keeps it for the
+ * lifetime of the instance (it finds it again after having counted
+ * elsewhere), so any number of thread pools may count into any number
+ * of instances. There are as many shards as there are hardware threads,
+ * plus one for the calling thread (and never fewer than
+ * <code>FUNEVALS_SHARDS</code>); should even more threads count into
+ * one instance, those get one more, shared shard, with atomic additions.
+ * <br />
+ * <br />A shard is only ever written by its owner thread, with relaxed
+ * atomic loads and stores (plain moves, no locked instructions),
+ * so a read racing the counting is well-defined, but it is only exact
+ * once the counting it is to see has stopped: it has to happen
+ * in the counting thread itself, or after joining the other ones,
+ * e.g. after <code>ThreadPool::wait()</code>.
  *
  * @author  Radislav (Radicchio) Golubtsov
  * @version 0.1.1
@@ -42,23 +122,107 @@ namespace NLPUCCLIHooke {
  */
 class FunEvals {
 private:
-    /** The number of function evaluations. */
-    unsigned int funEvals;
+    /** The last instance a thread has counted into, and its shard there. */
+    struct LastShard {
+        /** The instance id (0 for none). */
+        unsigned long long id;
+
+        /** The shard (the number of shards for the shared one). */
+        unsigned int shard;
+    };
+
+    /** The unique id of the instance (never reused). */
+    const unsigned long long id;
+
+    /** The number of the per-thread shards. */
+    const unsigned int nShards;
+
+    /** The per-thread counter shards (nShards of FUNEVALS_STRIDE). */
+    std::vector<std::atomic<unsigned long long> > shards;
+
+    /** The id of the thread owning each shard (0 for a free one). */
+    std::vector<std::atomic<unsigned long long> > owners;
+
+    /** The shared counter shard (for the threads without one). */
+    std::atomic<unsigned long long> shared[N_COUNTERS];
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Accesses the last instance the calling thread has counted
+     * into.
+     *
+     * @return The last instance of the calling thread.
+     */
+    static LastShard &lastShard();
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Finds the shard the calling thread owns, claiming a free one
+     * if it owns none.
+     *
+     * @return The shard, or <code>nShards</code> if none is free.
+     */
+    unsigned int claim();
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />The slow path of <code>add()</code>: finds (or claims)
+     * the shard of the calling thread if it has last counted elsewhere,
+     * and counts into the shared shard if the thread has no shard.
+     *
+     * @param counter The counter.
+     * @param count   The number of events.
+     */
+    void addShared(const Counter, const unsigned long long);
+
+    /** Copying is not allowed. */
+    FunEvals(const FunEvals &);
+    FunEvals &operator=(const FunEvals &);
 
 public:
     /**
-     * Getter for <code>funEvals</code>.
+     * Counts an event (or a number of them).
+     * <br />
+     * <br />Safe to call from any number of threads at once.
      *
-     * @return The number of function evaluations.
+     * @param counter The counter.
+     * @param count   The number of events.
+     */
+    void add(const Counter, const unsigned long long = 1);
+
+    /**
+     * Moves the events counted from one counter to another
+     * (e.g. the evaluations that turn out to be wasted).
+     *
+     * @param from  The counter to take the events from.
+     * @param to    The counter to put the events to.
+     * @param count The number of events.
      */
-    unsigned int getFunEvals();
+    void move(const Counter, const Counter, const unsigned long long = 1);
 
     /**
-     * Setter for <code>funEvals</code>.
+     * Reads a counter, merging its shards (exact once the counting
+     * threads have stopped, see above).
      *
-     * @param __funEvals The number of function evaluations.
+     * @param counter The counter.
+     *
+     * @return The number of events counted.
+     */
+    unsigned long long get(const Counter) const;
+
+    /**
+     * Getter for the number of function evaluations
+     * (a shorthand for <code>get(FUN_EVALS)</code>).
+     *
+     * @return The number of function evaluations.
      */
-    void setFunEvals(const unsigned int);
+    unsigned long long getFunEvals() const;
+
+    /** Zeroes all the counters (not to be done while counting). */
+    void reset();
 
     /** Default constructor. */
     FunEvals();
@@ -67,6 +231,47 @@ public:
     ~FunEvals();
 };
 
+// Helper method lastShard().
+inline FunEvals::LastShard &FunEvals::lastShard() {
+    // Constant-initialized, so there is no guard on the access.
+    static thread_local LastShard last = {0, 0};
+
+    return last;
+}
+
+// Counts an event (or a number of them).
+inline void FunEvals::add(const Counter counter,
+                          const unsigned long long count) {
+
+    LastShard &last = lastShard();
+
+    // The fast path: the thread's own shard (only the owner writes it).
+    if ((last.id == id) && (last.shard < nShards)) {
+        std::atomic<unsigned long long> &c
+            = shards[last.shard * FUNEVALS_STRIDE + counter];
+
+        c.store(c.load(std::memory_order_relaxed) + count,
+                std::memory_order_relaxed);
+    } else {
+        addShared(counter, count);
+    }
+}
+
+// Moves the events counted from one counter to another.
+inline void FunEvals::move(const Counter from,
+                           const Counter to,
+                           const unsigned long long count) {
+
+    // The shards may go "negative": only the merged sums are meaningful.
+    add(from, 0ULL - count);
+    add(to, count);
+}
+
+// Getter for the number of function evaluations.
+inline unsigned long long FunEvals::getFunEvals() const {
+    return get(FUN_EVALS);
+}
+
 } // namespace NLPUCCLIHooke
 
 #endif // __CC__FUNEVALS_H
@@ -21,307 +21,567 @@
  * (See the LICENSE file at the top of the source tree.)
  */
 
-#include "funevals.h"
-
-#ifndef WOODS
-    #include "rosenbrock.h"
-#else
-    #include "woods.h"
-#endif
-
-// The NLPUCCLIHooke namespace.
-namespace NLPUCCLIHooke {
-
-// Constant. The maximum number of variables.
-const unsigned int VARS = 250;
-
-// Constant. The stepsize geometric shrink.
-const double RHO_BEGIN = 0.5;
-
-// Constant. The stepsize geometric shrink.
-const double RHO_WOODS = 0.6;
-
-// Constant. The ending value of stepsize.
-const double EPSMIN = 1E-6;
-
-// Constant. The maximum number of iterations.
-const unsigned int IMAX = 5000;
-
-// Helper constants.
-const unsigned int INDEX_ZERO          =  0;
-const unsigned int INDEX_ONE           =  1;
-const unsigned int INDEX_TWO           =  2;
-const unsigned int INDEX_THREE         =  3;
-const unsigned int TWO                 =  2;
-const unsigned int FOUR                =  4;
-const double       MINUS_ONE_POINT_TWO = -1.2;
-const double       ONE_POINT_ZERO      =  1.0;
-const int          MINUS_THREE         = -3;
-const int          MINUS_ONE           = -1;
-const double       ZERO_POINT_FIVE     =  0.5;
-
-// Helper method bestNearby(...).
-double Hooke::bestNearby(double *delta,
-                         double *point,
-                         const double prevBest,
-                         const unsigned int nVars,
-                         const void *cFunEvals) {
-
-    double minF;
-    double z[VARS];
-    double fTmp;
-
-    unsigned int i;
-
-    minF = prevBest;
-
-    for (i = 0; i < nVars; i++) {
-        z[i] = point[i];
-    }
-
-    for (i = 0; i < nVars; i++) {
-        z[i] = point[i] + delta[i];
-
-#ifndef WOODS
-        Rosenbrock r;
+#include <cstring>
 
-        fTmp = r.f(z, nVars, cFunEvals);
-#else
-        Woods w;
+#include "rosenbrock.h"
+#include "woods.h"
+#include "mgh.h"
+#include "hookelanes.h"
+#include "evalpool.h"
+#include "problem.h"
 
-        fTmp = w.f(z, nVars, cFunEvals);
-#endif
-
-        if (fTmp < minF) {
-            minF = fTmp;
-        } else {
-            delta[i] = 0.0 - delta[i];
-            z[i]     = point[i] + delta[i];
+using namespace NLPUCCLIHooke;
 
-#ifndef WOODS
-            fTmp = r.f(z, nVars, cFunEvals);
-#else
-            fTmp = w.f(z, nVars, cFunEvals);
-#endif
+/**
+ * Helper function.
+ * <br />
+ * <br />Matches a command-line option of the form <code>--name=value</code>.
+ *
+ * @param arg  The command-line argument.
+ * @param name The option name (including the leading dashes).
+ *
+ * @return The option value, or <code>NULL</code> if the argument
+ *         is not the option given.
+ */
+static const char *optionValue(const char *arg, const char *name) {
+    std::size_t len = std::strlen(name);
 
-            if (fTmp < minF) {
-                minF = fTmp;
-            } else {
-                z[i] = point[i];
-            }
-        }
+    if ((std::strncmp(arg, name, len) != 0) || (arg[len] != '=')) {
+        return NULL;
     }
 
-    for (i = 0; i < nVars; i++) {
-        point[i] = z[i];
+    return (arg + len + 1);
+}
+
+/**
+ * Helper function.
+ * <br />
+ * <br />Parses the name of an exploratory move strategy.
+ *
+ * @param value The strategy name.
+ * @param poll  The strategy (output).
+ *
+ * @return <code>true</code> if the name is a known one.
+ */
+static bool parsePoll(const char *value, PollMode *poll) {
+    if (std::strcmp(value, "opportunistic") == 0) {
+        *poll = POLL_OPPORTUNISTIC;
+    } else if (std::strcmp(value, "complete") == 0) {
+        *poll = POLL_COMPLETE;
+    } else if (std::strcmp(value, "speculative") == 0) {
+        *poll = POLL_SPECULATIVE;
+    } else {
+        return false;
     }
 
-    return minF;
+    return true;
 }
 
-// Main optimization method hooke(...).
-unsigned int Hooke::hooke(const unsigned int nVars,
-                          const double *startPt,
-                          double *endPt,
-                          const double rho,
-                          const double epsilon,
-                          const unsigned int iterMax) {
-
-    unsigned int i;
-    unsigned int iAdj;
-    unsigned int iters;
-    unsigned int j;
-    unsigned int keep;
-
-    double newX[VARS];
-    double xBefore[VARS];
-    double delta[VARS];
-    double stepLength;
-    double fBefore;
-    double newF;
-    double tmp;
-
-    for (i = 0; i < nVars; i++) {
-        newX[i] = xBefore[i] = startPt[i];
-
-        delta[i] = std::fabs(startPt[i] * rho);
-
-        if (delta[i] == 0.0) {
-            delta[i] = rho;
-        }
+/**
+ * Helper function.
+ * <br />
+ * <br />Parses a trace verbosity: <code>none</code>, <code>summary</code>,
+ * <code>full</code>, or a number k (every k-th iteration).
+ *
+ * @param value The verbosity.
+ * @param level The trace level (output).
+ * @param every The iteration step of <code>TRACE_EVERY</code> (output).
+ *
+ * @return <code>true</code> if the verbosity is a valid one.
+ */
+static bool parseVerbosity(const char *value,
+                           TraceLevel *level,
+                           unsigned int *every) {
+
+    char *end;
+
+    if (std::strcmp(value, "none") == 0) {
+        *level = TRACE_NONE;
+    } else if (std::strcmp(value, "summary") == 0) {
+        *level = TRACE_SUMMARY;
+    } else if (std::strcmp(value, "full") == 0) {
+        *level = TRACE_FULL;
+    } else {
+        *every = std::strtoul(value, &end, 10);
+        *level = TRACE_EVERY;
+
+        return ((*end == '\0') && (*every > 0));
     }
 
-    iAdj       = 0;
-    stepLength = rho;
-    iters      = 0;
-
-    // Instantiating the FunEvals class.
-    FunEvals *fe = new FunEvals();
+    return true;
+}
 
-#ifndef WOODS
-    Rosenbrock r;
+/**
+ * Helper function.
+ * <br />
+ * <br />Parses the name of a trace layout.
+ *
+ * @param value  The layout name.
+ * @param format The layout (output).
+ *
+ * @return <code>true</code> if the name is a known one.
+ */
+static bool parseTraceFormat(const char *value, TraceFormat *format) {
+    if (std::strcmp(value, "text") == 0) {
+        *format = TRACE_TEXT;
+    } else if (std::strcmp(value, "jsonl") == 0) {
+        *format = TRACE_JSONL;
+    } else if (std::strcmp(value, "csv") == 0) {
+        *format = TRACE_CSV;
+    } else if (std::strcmp(value, "binary") == 0) {
+        *format = TRACE_BINARY;
+    } else {
+        return false;
+    }
 
-    fBefore = r.f(newX, nVars, fe);
-#else
-    Woods w;
+    return true;
+}
 
-    fBefore = w.f(newX, nVars, fe);
-#endif
+/**
+ * Helper function.
+ * <br />
+ * <br />Parses the name of an asynchronous trace policy.
+ *
+ * @param value  The policy name.
+ * @param policy The policy (output).
+ *
+ * @return <code>true</code> if the name is a known one.
+ */
+static bool parseTracePolicy(const char *value, TracePolicy *policy) {
+    if (std::strcmp(value, "drop") == 0) {
+        *policy = TRACE_DROP;
+    } else if (std::strcmp(value, "block") == 0) {
+        *policy = TRACE_BLOCK;
+    } else {
+        return false;
+    }
 
-    newF = fBefore;
+    return true;
+}
 
-    while ((iters < iterMax) && (stepLength > epsilon)) {
-        iters++;
-        iAdj++;
+/**
+ * Helper function.
+ * <br />
+ * <br />Tells whether a number of lanes is one of the supported ones.
+ *
+ * @param nLanes The number of lanes.
+ *
+ * @return <code>true</code> for 4, 8 or 16.
+ */
+static bool validLanes(const unsigned long nLanes) {
+    return ((nLanes == LANES_AVX2)
+         || (nLanes == LANES_AVX512)
+         || (nLanes == LANES_WIDE));
+}
 
-        std::cout << "\n" // Not using here std::endl -
-                          // see http://en.cppreference.com/w/cpp/io/manip/endl
-                          // for the reason why.
-                  << "After " << std::setw(5) << fe->getFunEvals()
-                  << " funevals, f(x) =  " << std::setprecision(4)
-                  << std::scientific << fBefore << " at\n";
+// Starting guess for Rosenbrock's test function.
+static const double ROSENBROCK_START[] = {
+    MINUS_ONE_POINT_TWO, ONE_POINT_ZERO
+};
+
+// Starting guess test problem "Woods".
+static const double WOODS_START[] = {
+    MINUS_THREE, MINUS_ONE, MINUS_THREE, MINUS_ONE
+};
+
+// The standard starting guesses of the MGH test problems (see mgh.h).
+static const double HELICAL_START[]     = {-1, 0, 0};
+static const double BIGGS_START[]       = {1, 2, 1, 1, 1, 1};
+static const double GAUSSIAN_START[]    = {.4, 1, 0};
+static const double POWELLBS_START[]    = {0, 1};
+static const double BOX_START[]         = {0, 10, 20};
+static const double VARDIM_START[]      = {
+    .9, .8, .7, .6, .5, .4, .3, .2, .1, 0
+};
+static const double WATSON_START[]      = {0, 0, 0, 0, 0, 0};
+static const double PENALTY1_START[]    = {1, 2, 3, 4};
+static const double PENALTY2_START[]    = {.5, .5, .5, .5};
+static const double BROWNBS_START[]     = {1, 1};
+static const double BROWNDENNIS_START[] = {25, 5, -5, -1};
+static const double GULF_START[]        = {5, 2.5, .15};
+static const double TRIG_START[]        = {
+    .1, .1, .1, .1, .1, .1, .1, .1, .1, .1
+};
+static const double POWELL_START[]      = {3, -1, 0, 1};
+static const double BEALE_START[]       = {1, 1};
+static const double CHEBYQUAD_START[]   = {
+    1 / 9., 2 / 9., 3 / 9., 4 / 9., 5 / 9., 6 / 9., 7 / 9., 8 / 9.
+};
 
-        for (j = 0; j < nVars; j++) {
-            std::cout << "   x[" << std::setw(2) << j << "] = " << xBefore[j]
-                      << "\n";
-        }
+/*
+ * The problem registry. The first entry is the default one.
+ * A new problem takes an objective function class (see objective.h)
+ * and a row here, which also tells how many variables the objective
+ * function can take (the batch files get checked against it). The rows
+ * of a batch file with a problem column name the problems here.
+ */
+static const Problem PROBLEMS[] = {
+    {"rosenbrock", Rosenbrock::NVARS, 2, UNBOUNDED_VARS,
+     ROSENBROCK_START, RHO_BEGIN, NULL,
+     &runProblem<Rosenbrock, Rosenbrock::NVARS>,
+     &newSolvers<Rosenbrock, Rosenbrock::NVARS>},
+
+    {"woods", Woods::NVARS, 4, UNBOUNDED_VARS,
+     WOODS_START, RHO_WOODS,
+     "True answer: f(1, 1, 1, 1) = 0.",
+     &runProblem<Woods, Woods::NVARS>,
+     &newSolvers<Woods, Woods::NVARS>},
+
+    {"helical", HelicalValley::NVARS,
+     HelicalValley::NVARS, HelicalValley::NVARS,
+     HELICAL_START, RHO_BEGIN,
+     "True answer: f(1, 0, 0) = 0.",
+     &runProblem<HelicalValley, HelicalValley::NVARS>,
+     &newSolvers<HelicalValley, HelicalValley::NVARS>},
+
+    {"biggs", BiggsExp6::NVARS, BiggsExp6::NVARS, BiggsExp6::NVARS,
+     BIGGS_START, RHO_BEGIN,
+     "True answer: f(1, 10, 1, 5, 4, 3) = 0.",
+     &runProblem<BiggsExp6, BiggsExp6::NVARS>,
+     &newSolvers<BiggsExp6, BiggsExp6::NVARS>},
+
+    {"gaussian", Gaussian::NVARS, Gaussian::NVARS, Gaussian::NVARS,
+     GAUSSIAN_START, RHO_BEGIN,
+     "True answer: f = 1.12793e-8.",
+     &runProblem<Gaussian, Gaussian::NVARS>,
+     &newSolvers<Gaussian, Gaussian::NVARS>},
+
+    {"powellbs", PowellBadlyScaled::NVARS,
+     PowellBadlyScaled::NVARS, PowellBadlyScaled::NVARS,
+     POWELLBS_START, RHO_BEGIN,
+     "True answer: f(1.098e-5, 9.106) = 0.",
+     &runProblem<PowellBadlyScaled, PowellBadlyScaled::NVARS>,
+     &newSolvers<PowellBadlyScaled, PowellBadlyScaled::NVARS>},
+
+    {"box", Box3D::NVARS, Box3D::NVARS, Box3D::NVARS,
+     BOX_START, RHO_BEGIN,
+     "True answer: f(1, 10, 1) = 0.",
+     &runProblem<Box3D, Box3D::NVARS>,
+     &newSolvers<Box3D, Box3D::NVARS>},
+
+    {"vardim", VariablyDimensioned::NVARS, 1, UNBOUNDED_VARS,
+     VARDIM_START, RHO_BEGIN,
+     "True answer: f(1, ..., 1) = 0.",
+     &runProblem<VariablyDimensioned, VariablyDimensioned::NVARS>,
+     &newSolvers<VariablyDimensioned, VariablyDimensioned::NVARS>},
+
+    {"watson", Watson::NVARS, 2, 31,
+     WATSON_START, RHO_BEGIN,
+     "True answer: f = 2.28767e-3.",
+     &runProblem<Watson, Watson::NVARS>,
+     &newSolvers<Watson, Watson::NVARS>},
+
+    {"penalty1", PenaltyI::NVARS, 1, UNBOUNDED_VARS,
+     PENALTY1_START, RHO_BEGIN,
+     "True answer: f = 2.24997e-5.",
+     &runProblem<PenaltyI, PenaltyI::NVARS>,
+     &newSolvers<PenaltyI, PenaltyI::NVARS>},
+
+    {"penalty2", PenaltyII::NVARS, 1, UNBOUNDED_VARS,
+     PENALTY2_START, RHO_BEGIN,
+     "True answer: f = 9.37629e-6.",
+     &runProblem<PenaltyII, PenaltyII::NVARS>,
+     &newSolvers<PenaltyII, PenaltyII::NVARS>},
+
+    {"brownbs", BrownBadlyScaled::NVARS,
+     BrownBadlyScaled::NVARS, BrownBadlyScaled::NVARS,
+     BROWNBS_START, RHO_BEGIN,
+     "True answer: f(1e6, 2e-6) = 0.",
+     &runProblem<BrownBadlyScaled, BrownBadlyScaled::NVARS>,
+     &newSolvers<BrownBadlyScaled, BrownBadlyScaled::NVARS>},
+
+    {"browndennis", BrownDennis::NVARS, BrownDennis::NVARS, BrownDennis::NVARS,
+     BROWNDENNIS_START, RHO_BEGIN,
+     "True answer: f = 85822.2.",
+     &runProblem<BrownDennis, BrownDennis::NVARS>,
+     &newSolvers<BrownDennis, BrownDennis::NVARS>},
+
+    {"gulf", GulfResearch::NVARS, GulfResearch::NVARS, GulfResearch::NVARS,
+     GULF_START, RHO_BEGIN,
+     "True answer: f(50, 25, 1.5) = 0.",
+     &runProblem<GulfResearch, GulfResearch::NVARS>,
+     &newSolvers<GulfResearch, GulfResearch::NVARS>},
+
+    {"trig", Trigonometric::NVARS, 1, UNBOUNDED_VARS,
+     TRIG_START, RHO_BEGIN,
+     "True answer: f = 0.",
+     &runProblem<Trigonometric, Trigonometric::NVARS>,
+     &newSolvers<Trigonometric, Trigonometric::NVARS>},
+
+    {"powell", PowellSingular::NVARS, 4, UNBOUNDED_VARS,
+     POWELL_START, RHO_BEGIN,
+     "True answer: f(0, 0, 0, 0) = 0.",
+     &runProblem<PowellSingular, PowellSingular::NVARS>,
+     &newSolvers<PowellSingular, PowellSingular::NVARS>},
+
+    {"beale", Beale::NVARS, Beale::NVARS, Beale::NVARS,
+     BEALE_START, RHO_BEGIN,
+     "True answer: f(3, 0.5) = 0.",
+     &runProblem<Beale, Beale::NVARS>,
+     &newSolvers<Beale, Beale::NVARS>},
+
+    {"chebyquad", Chebyquad::NVARS, 1, VARS,
+     CHEBYQUAD_START, RHO_BEGIN,
+     "True answer: f = 3.51687e-3.",
+     &runProblem<Chebyquad, Chebyquad::NVARS>,
+     &newSolvers<Chebyquad, Chebyquad::NVARS>}
+};
+
+// Helper constant.
+static const unsigned int N_PROBLEMS = sizeof(PROBLEMS) / sizeof(PROBLEMS[0]);
+
+/**
+ * Helper function.
+ * <br />
+ * <br />Looks a problem up in the registry.
+ *
+ * @param name The problem name.
+ *
+ * @return The problem, or <code>NULL</code> if there is none by the name.
+ */
+static const Problem *findProblem(const char *name) {
+    unsigned int k;
 
-        // Find best new point, one coord at a time.
-        for (i = 0; i < nVars; i++) {
-            newX[i] = xBefore[i];
+    for (k = 0; k < N_PROBLEMS; k++) {
+        if (std::strcmp(PROBLEMS[k].name, name) == 0) {
+            return &PROBLEMS[k];
         }
+    }
 
-        newF = bestNearby(delta, newX, fBefore, nVars, fe);
+    return NULL;
+}
 
-        // If we made some improvements, pursue that direction.
-        keep = 1;
+/**
+ * Helper function.
+ * <br />
+ * <br />Picks the default problem by the program name: a program
+ * (or a link to it) named <code>hooke-NAME</code> solves the problem
+ * <code>NAME</code>, so that <code>hooke-woods</code> keeps working;
+ * anything else solves the first registered one.
+ *
+ * @param prog The program name (<code>argv[0]</code>).
+ *
+ * @return The problem.
+ */
+static const Problem *defaultProblem(const char *prog) {
+    const char    *base = std::strrchr(prog, '/');
+    const char    *dash;
+    const Problem *problem;
 
-        while ((newF < fBefore) && (keep == 1)) {
-            iAdj = 0;
+    base = (base != NULL) ? base + 1 : prog;
+    dash = std::strrchr(base, '-');
 
-            for (i = 0; i < nVars; i++) {
-                // Firstly, arrange the sign of delta[].
-                if (newX[i] <= xBefore[i]) {
-                    delta[i] = 0.0 - std::fabs(delta[i]);
-                } else {
-                    delta[i] = std::fabs(delta[i]);
-                }
+    if ((dash != NULL) && ((problem = findProblem(dash + 1)) != NULL)) {
+        return problem;
+    }
 
-                // Now, move further in this direction.
-                tmp        = xBefore[i];
-                xBefore[i] = newX[i];
-                newX[i]    = newX[i] + newX[i] - tmp;
-            }
+    return &PROBLEMS[0];
+}
 
-            fBefore = newF;
+/**
+ * Helper function.
+ * <br />
+ * <br />Solves a problem with its objective function evaluated
+ * by a pool of worker processes instead of in process.
+ *
+ * @param problem The problem.
+ * @param opts    The command-line options.
+ *
+ * @return The exit status.
+ */
+static int runRemote(const Problem &problem, const Options &opts) {
+    int ret;
 
-            newF = bestNearby(delta, newX, fBefore, nVars, fe);
+    EvalPool pool(opts.remote, problem.name, opts.nRemote);
 
-            // If the further (optimistic) move was bad....
-            if (newF >= fBefore) {
-                break;
-            }
+    RemoteObjective::setPool(&pool);
 
-            /*
-             * Make sure that the differences between the new and the old
-             * points are due to actual displacements; beware of roundoff
-             * errors that might cause newF < fBefore.
-             */
-            keep = 0;
+    ret = runProblem<RemoteObjective, DYNAMIC_VARS>(problem, opts);
 
-            for (i = 0; i < nVars; i++) {
-                keep = 1;
+    RemoteObjective::setPool(NULL);
 
-                if (std::fabs(newX[i] - xBefore[i])
-                    > (ZERO_POINT_FIVE * std::fabs(delta[i]))) {
+    if (pool.failed()) {
+        std::cerr << opts.prog << ": " << problem.name
+                  << ": the evaluation workers have failed\n";
 
-                    break;
-                } else {
-                    keep = 0;
-                }
-            }
-        }
+        return EXIT_FAILURE;
+    }
 
-        if ((stepLength >= epsilon) && (newF >= fBefore)) {
-            stepLength = stepLength * rho;
+    return ret;
+}
 
-            for (i = 0; i < nVars; i++) {
-                delta[i] *= rho;
+// Main program function main() :-).
+int main(int argc, char **argv) {
+    unsigned int k;
+    int          arg;
+    int          ret;
+    const char  *value;
+
+    const Problem *problem = defaultProblem(argv[0]);
+
+    bool picked = false;
+
+    Options opts;
+
+    opts.prog     = argv[0];
+    opts.iterMax  = IMAX;
+    opts.epsilon  = EPSMIN;
+    opts.nStarts  = 0;
+    opts.nThreads = 0;
+    opts.nCache   = 0;
+    opts.nLanes   = 0;
+    opts.poll     = POLL_OPPORTUNISTIC;
+    opts.incr     = false;
+    opts.abort    = false;
+    opts.level    = TRACE_FULL;
+    opts.every    = 1;
+    opts.format   = TRACE_TEXT;
+    opts.traceTo  = NULL;
+    opts.async    = false;
+    opts.policy   = TRACE_BLOCK;
+    opts.batchIn  = NULL;
+    opts.batchOut = NULL;
+    opts.batchFmt = NULL;
+    opts.nReps    = 0;
+    opts.remote   = NULL;
+    opts.nRemote  = 1;
+
+    opts.problems  = PROBLEMS;
+    opts.nProblems = N_PROBLEMS;
+
+    for (arg = 1; arg < argc; arg++) {
+        if (std::strcmp(argv[arg], "--incremental") == 0) {
+            opts.incr = true;
+        } else if (std::strcmp(argv[arg], "--early-abort") == 0) {
+            opts.abort = true;
+        } else if (((value = optionValue(argv[arg], "--objective")) != NULL)
+                && ((problem = findProblem(value)) != NULL)) {
+
+            picked = true;
+        } else if (std::strcmp(argv[arg], "--bench") == 0) {
+            opts.nReps = BENCH_REPS;
+        } else if (((value = optionValue(argv[arg], "--bench")) != NULL)
+                && (std::strtoul(value, NULL, 10) > 0)) {
+
+            opts.nReps = std::strtoul(value, NULL, 10);
+        } else if ((value = optionValue(argv[arg], "--starts")) != NULL) {
+            opts.nStarts = std::strtoul(value, NULL, 10);
+        } else if ((value = optionValue(argv[arg], "--threads")) != NULL) {
+            opts.nThreads = std::strtoul(value, NULL, 10);
+        } else if (((value = optionValue(argv[arg], "--lanes")) != NULL)
+                && validLanes(std::strtoul(value, NULL, 10))) {
+
+            opts.nLanes = std::strtoul(value, NULL, 10);
+        } else if (((value = optionValue(argv[arg], "--verbosity")) != NULL)
+                && parseVerbosity(value, &opts.level, &opts.every)) {
+
+            continue;
+        } else if (((value = optionValue(argv[arg], "--trace-format"))
+                    != NULL) && parseTraceFormat(value, &opts.format)) {
+
+            continue;
+        } else if (((value = optionValue(argv[arg], "--trace-async"))
+                    != NULL) && parseTracePolicy(value, &opts.policy)) {
+
+            opts.async = true;
+        } else if ((value = optionValue(argv[arg], "--trace-file")) != NULL) {
+            opts.traceTo = value;
+        } else if ((value = optionValue(argv[arg], "--batch")) != NULL) {
+            opts.batchIn = value;
+        } else if ((value = optionValue(argv[arg], "--batch-out"))
+                   != NULL) {
+
+            opts.batchOut = value;
+        } else if (((value = optionValue(argv[arg], "--batch-format"))
+                    != NULL) && ((std::strcmp(value, "csv") == 0)
+                              || (std::strcmp(value, "binary") == 0))) {
+
+            opts.batchFmt = value;
+        } else if ((value = optionValue(argv[arg], "--cache")) != NULL) {
+            opts.nCache = std::strtoul(value, NULL, 10);
+        } else if ((value = optionValue(argv[arg], "--remote")) != NULL) {
+            opts.remote = value;
+        } else if (((value = optionValue(argv[arg], "--remote-workers"))
+                    != NULL) && (std::strtoul(value, NULL, 10) > 0)) {
+
+            opts.nRemote = std::strtoul(value, NULL, 10);
+        } else if (((value = optionValue(argv[arg], "--poll")) == NULL)
+                || !parsePoll(value, &opts.poll)) {
+
+            std::cerr << "Usage: " << argv[0] << " [--objective=";
+
+            for (k = 0; k < N_PROBLEMS; k++) {
+                std::cerr << ((k > 0) ? "|" : "") << PROBLEMS[k].name;
             }
+
+            std::cerr << "]"
+                         " [--starts=K] [--threads=T] [--lanes=4|8|16]"
+                         " [--cache=ENTRIES]"
+                         " [--incremental] [--early-abort]"
+                         " [--poll=opportunistic|complete|speculative]"
+                         " [--verbosity=none|summary|full|K]"
+                         " [--trace-format=text|jsonl|csv|binary]"
+                         " [--trace-file=PATH] [--trace-async=drop|block]"
+                         " [--batch=PATH --batch-out=PATH"
+                         " [--batch-format=csv|binary]]"
+                         " [--bench[=REPS]]"
+                         " [--remote=COMMAND [--remote-workers=K]]\n"
+                         "The --batch rows are starts of the --objective"
+                         " problem, unless the CSV header names a first"
+                         " column 'problem'\n(then every row starts with"
+                         " the name of its problem).\n";
+
+            return EXIT_FAILURE;
         }
     }
 
-    for (i = 0; i < nVars; i++) {
-        endPt[i] = xBefore[i];
+    // The binary trace needs a file of its own and is written in place.
+    if ((opts.format == TRACE_BINARY)
+        && ((opts.traceTo == NULL) || opts.async)) {
+
+        std::cerr << argv[0] << ": --trace-format=binary needs"
+                     " --trace-file and no --trace-async\n";
+
+        return EXIT_FAILURE;
     }
 
-    // Destroying the FunEvals class instance.
-    delete fe;
+    if ((opts.batchIn == NULL) != (opts.batchOut == NULL)) {
+        std::cerr << argv[0] << ": --batch and --batch-out go together\n";
 
-    return iters;
-}
+        return EXIT_FAILURE;
+    }
 
-// Default constructor.
-Hooke::Hooke() {}
+    /*
+     * The benchmark: one table row per problem, for all the registered
+     * ones unless a problem has been picked. It fails if any row does.
+     */
+    if (opts.nReps > 0) {
+        std::cout << BENCH_HEADER << "\n";
 
-// Destructor.
-Hooke::~Hooke() {}
+        ret = EXIT_SUCCESS;
 
-} // namespace NLPUCCLIHooke
+        for (k = 0; k < N_PROBLEMS; k++) {
+            if (picked && (&PROBLEMS[k] != problem)) {
+                continue;
+            }
 
-using namespace NLPUCCLIHooke;
+            if (((opts.remote != NULL) ? runRemote(PROBLEMS[k], opts)
+                                       : PROBLEMS[k].run(PROBLEMS[k], opts))
+                != EXIT_SUCCESS) {
 
-// Main program function main() :-).
-int main(void) {
-    unsigned int nVars;
-    unsigned int iterMax;
-    unsigned int jj;
-    unsigned int i;
-
-    double startPt[VARS];
-    double rho;
-    double epsilon;
-    double endPt[VARS];
-
-#ifndef WOODS
-    // Starting guess for Rosenbrock's test function.
-    nVars                = TWO;
-    startPt[INDEX_ZERO]  = MINUS_ONE_POINT_TWO;
-    startPt[INDEX_ONE]   = ONE_POINT_ZERO;
-    rho                  = RHO_BEGIN;
-#else
-    // Starting guess test problem "Woods".
-    nVars                = FOUR;
-    startPt[INDEX_ZERO]  = MINUS_THREE;
-    startPt[INDEX_ONE]   = MINUS_ONE;
-    startPt[INDEX_TWO]   = MINUS_THREE;
-    startPt[INDEX_THREE] = MINUS_ONE;
-    rho                  = RHO_WOODS;
-#endif
-
-    iterMax = IMAX;
-    epsilon = EPSMIN;
-
-    // Instantiating the Hooke class.
-    Hooke *h = new Hooke();
-
-    jj = h->hooke(nVars, startPt, endPt, rho, epsilon, iterMax);
-
-    std::cout << "\n\n\nHOOKE USED " << jj << " ITERATIONS, AND RETURNED\n";
-
-    for (i = 0; i < nVars; i++) {
-        std::cout << "x[" << std::setw(3) << i << "] = " << std::setw(15)
-                  << std::setprecision(7) << endPt[i] << " \n";
-    }
+                ret = EXIT_FAILURE;
+            }
+        }
 
-#ifdef WOODS
-    std::cout << "True answer: f(1, 1, 1, 1) = 0." << std::endl;
-#endif
+        return ret;
+    }
 
-    // Destroying the Hooke class instance.
-    delete h;
+    // The objective function evaluated by the worker processes.
+    if (opts.remote != NULL) {
+        return runRemote(*problem, opts);
+    }
 
-    return EXIT_SUCCESS;
+    return problem->run(*problem, opts);
 }
 
 // vim:set nu et ts=4 sw=4:
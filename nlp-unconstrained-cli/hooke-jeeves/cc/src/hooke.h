@@ -29,17 +29,47 @@
 #include <iomanip>
 #include <cmath>
 
+#include "funevals.h"
+#include "objective.h"
+#include "evalcache.h"
+#include "threadpool.h"
+#include "trace.h"
+#include "workspace.h"
+
 /**
  * The <code>NLPUCCLIHooke</code> namespace is used as a container
  * for the <code>Hooke</code> class.
  */
 namespace NLPUCCLIHooke {
 
-/** Constant. The maximum number of variables. */
-extern const unsigned int VARS;
+/*
+ * The constants below are defined right in the header (rather than
+ * in hooke.cc), so that they are compile-time constant expressions
+ * which get folded into the objective functions inlined into the engine.
+ */
+
+/**
+ * Constant. The maximum number of variables of the problems set up
+ * in <code>main()</code> (the solver itself has no such limit).
+ */
+const unsigned int VARS = 250;
+
+/**
+ * Constant. The dimension template argument which selects
+ * the runtime-N engine (the number of variables is then passed
+ * to <code>hooke()</code> on each call).
+ */
+const unsigned int DYNAMIC_VARS = 0;
+
+/**
+ * Constant. The number of variables from which on the objective
+ * functions evaluate a single point with their vector kernels
+ * (see <code>Woods::fVector()</code>).
+ */
+const unsigned int VECTOR_MIN_VARS = 32;
 
 /** Constant. The stepsize geometric shrink. */
-extern const double RHO_BEGIN;
+const double RHO_BEGIN = 0.5;
 
 /**
  * Constant. The stepsize geometric shrink.
@@ -50,30 +80,64 @@ extern const double RHO_BEGIN;
  * when rho = 0.5, but fares poorly with rho = 0.6, and better again
  * with rho = 0.8.
  */
-extern const double RHO_WOODS;
+const double RHO_WOODS = 0.6;
 
 /** Constant. The ending value of stepsize. */
-extern const double EPSMIN;
+const double EPSMIN = 1E-6;
 
 /** Constant. The maximum number of iterations. */
-extern const unsigned int IMAX;
+const unsigned int IMAX = 5000;
 
 /** Helper constants. */
-extern const unsigned int INDEX_ZERO;
-extern const unsigned int INDEX_ONE;
-extern const unsigned int INDEX_TWO;
-extern const unsigned int INDEX_THREE;
-extern const unsigned int TWO;
-extern const unsigned int FOUR;
-extern const double       MINUS_ONE_POINT_TWO;
-extern const double       ONE_POINT_ZERO;
-extern const int          MINUS_THREE;
-extern const int          MINUS_ONE;
-extern const double       ZERO_POINT_FIVE;
+const unsigned int INDEX_ZERO          =  0;
+const unsigned int INDEX_ONE           =  1;
+const unsigned int INDEX_TWO           =  2;
+const unsigned int INDEX_THREE         =  3;
+const double       MINUS_ONE_POINT_TWO = -1.2;
+const double       ONE_POINT_ZERO      =  1.0;
+const int          MINUS_THREE         = -3;
+const int          MINUS_ONE           = -1;
+const double       ZERO_POINT_FIVE     =  0.5;
+
+/** The exploratory move (poll) strategies. */
+enum PollMode {
+    /**
+     * The sequential opportunistic sweep: one coordinate at a time,
+     * accepting any improvement greedily (the default).
+     */
+    POLL_OPPORTUNISTIC,
+
+    /**
+     * The complete poll (in the style of generalized pattern search):
+     * all the 2n points around the base point are evaluated concurrently,
+     * then the best of them is moved to.
+     */
+    POLL_COMPLETE,
+
+    /**
+     * The speculative sweep: the same trajectory as the opportunistic one,
+     * but both the +delta and -delta probes of a coordinate are evaluated
+     * at once, and the unneeded result is discarded.
+     */
+    POLL_SPECULATIVE
+};
 
 /**
- * The <code>Hooke</code> class contains methods for solving a nonlinear
- * optimization problem using the algorithm of Hooke and Jeeves.
+ * The <code>Hooke</code> class template contains methods for solving
+ * a nonlinear optimization problem using the algorithm of Hooke and Jeeves.
+ * <br />
+ * <br />The objective function is bound at compile time, so its body
+ * gets inlined into the exploratory loop. When the number of variables
+ * is fixed as well (<code>N</code> is not <code>DYNAMIC_VARS</code>),
+ * all the loops over coordinates are fully unrolled.
+ * <br />
+ * <br />The work arrays come from a <code>Workspace</code>: a caller-owned
+ * one (see <code>setWorkspace()</code>), or else one allocated per solve.
+ *
+ * @param Objective The class providing the objective function
+ *                  as <code>f(x, n, funEvals)</code>.
+ * @param N         The number of variables, or <code>DYNAMIC_VARS</code>
+ *                  to pass it at runtime.
  *
  * @author  Radislav (Radicchio) Golubtsov
  * @version 0.1.1
@@ -81,8 +145,126 @@ extern const double       ZERO_POINT_FIVE;
  * @see     Woods
  * @since   hooke-jeeves 0.1
  */
+template<typename Objective, unsigned int N = DYNAMIC_VARS>
 class Hooke {
 private:
+    /** The objective function provider. */
+    Objective objective;
+
+    /** The per-iteration trace switch. */
+    bool trace;
+
+    /** The caller-owned trace (optional). */
+    Trace *tracer;
+
+    /** The trace used when no caller-owned one is set. */
+    Trace textTrace;
+
+    /** The exploratory move strategy. */
+    PollMode poll;
+
+    /** The thread pool for the concurrent poll strategies (optional). */
+    ThreadPool *pool;
+
+    /** The objective function values cache (optional). */
+    EvalCache *cache;
+
+    /** The incremental evaluation switch. */
+    bool incremental;
+
+    /** The early-abort evaluation switch. */
+    bool earlyAbort;
+
+    /** The caller-owned solver workspace (optional). */
+    Workspace *workspace;
+
+    /** The workspace of the solve in progress. */
+    Workspace *ws;
+
+    /** The in-place (moved coordinates list driven) sweep switch. */
+    bool inPlace;
+
+    /** Whether the solve in progress tracks the moved coordinates. */
+    bool sparse;
+
+    /**
+     * Whether the coordinates off the moved list still have to get
+     * their delta negated (which a dense pattern move does right away).
+     */
+    bool flipPending;
+
+    /** The length of the moved coordinates list. */
+    unsigned int nMoved;
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Accounts for the bytes written to the work arrays.
+     *
+     * @param funEvals  The number of function evaluations counter.
+     * @param bytes     The number of bytes written.
+     */
+    void traffic(FunEvals *, const unsigned long long);
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Puts a coordinate on the moved coordinates list
+     * (unless it is there already).
+     *
+     * @param i         The index of the coordinate.
+     * @param funEvals  The number of function evaluations counter.
+     */
+    void touch(const unsigned int, FunEvals *);
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Resolves the actual number of variables: the compile-time one
+     * if it is fixed, otherwise the one passed in.
+     *
+     * @param nVars The number of variables passed at runtime.
+     *
+     * @return The number of variables to iterate over.
+     */
+    unsigned int vars(const unsigned int) const;
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Evaluates the objective function, going through the cache
+     * (if any) first.
+     *
+     * @param x         The point at which f(x) should be evaluated.
+     * @param n         The number of coordinates of <code>x</code>.
+     * @param funEvals  The number of function evaluations counter.
+     *
+     * @return The objective function value.
+     */
+    double evaluate(const double *, const unsigned int, FunEvals *);
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Evaluates the objective function at a probe point that only
+     * matters if it beats <code>threshold</code>: with early abort on,
+     * the evaluation may stop short (see <code>HasFBounded</code>),
+     * returning a value not less than <code>threshold</code>.
+     * Rejected values are never cached.
+     *
+     * @param x         The point at which f(x) should be evaluated.
+     * @param n         The number of coordinates of <code>x</code>.
+     * @param threshold The value to beat.
+     * @param funEvals  The number of function evaluations counter.
+     *
+     * @return The objective function value, or a partial value
+     *         not less than <code>threshold</code>.
+     */
+    double probe(const double *,
+                 const unsigned int,
+                 const double,
+                 FunEvals *);
+
     /**
      * Helper method.
      * <br />
@@ -93,8 +275,7 @@ private:
      * @param point     The coordinate from where to begin.
      * @param prevBest  The previous best-valued coordinate.
      * @param nVars     The number of variables.
-     * @param cFunEvals The number of function evaluations container
-     *                  (FunEvals *).
+     * @param funEvals  The number of function evaluations counter.
      *
      * @return The objective function value at a nearby.
      */
@@ -102,7 +283,94 @@ private:
                       double *,
                       const double,
                       const unsigned int,
-                      const void *);
+                      FunEvals *);
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Given a point, evaluate all the 2n points nearby at once
+     * (on the thread pool, if any) and move to the best one.
+     *
+     * @param delta     The delta between <code>prevBest</code>
+     *                  and <code>point</code>.
+     * @param point     The coordinate from where to begin.
+     * @param prevBest  The previous best-valued coordinate.
+     * @param nVars     The number of variables.
+     * @param funEvals  The number of function evaluations counter.
+     *
+     * @return The objective function value at a nearby.
+     */
+    double completePoll(double *,
+                        double *,
+                        const double,
+                        const unsigned int,
+                        FunEvals *);
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Given a point, look for a better one nearby, one coord at a time,
+     * evaluating the -delta probe of each coordinate (on the thread pool,
+     * if any) alongside the +delta one.
+     *
+     * @param delta     The delta between <code>prevBest</code>
+     *                  and <code>point</code>.
+     * @param point     The coordinate from where to begin.
+     * @param prevBest  The previous best-valued coordinate.
+     * @param nVars     The number of variables.
+     * @param funEvals  The number of function evaluations counter.
+     *
+     * @return The objective function value at a nearby.
+     */
+    double speculativeSweep(double *,
+                            double *,
+                            const double,
+                            const unsigned int,
+                            FunEvals *);
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Given a point, look for a better one nearby, one coord at a time,
+     * updating the objective function value incrementally
+     * (see <code>HasFDelta</code>) rather than from scratch on each probe.
+     *
+     * @param delta     The delta between <code>prevBest</code>
+     *                  and <code>point</code>.
+     * @param point     The coordinate from where to begin.
+     * @param prevBest  The previous best-valued coordinate.
+     * @param nVars     The number of variables.
+     * @param funEvals  The number of function evaluations counter.
+     *
+     * @return The objective function value at a nearby.
+     */
+    double incrementalSweep(double *,
+                            double *,
+                            const double,
+                            const unsigned int,
+                            FunEvals *);
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Given a point, look for a better one nearby, one coord at a time,
+     * probing the point in place (rather than a copy of it) and putting
+     * the coordinates it moves on the moved coordinates list.
+     *
+     * @param delta     The delta between <code>prevBest</code>
+     *                  and <code>point</code>.
+     * @param point     The coordinate from where to begin.
+     * @param prevBest  The previous best-valued coordinate.
+     * @param nVars     The number of variables.
+     * @param funEvals  The number of function evaluations counter.
+     *
+     * @return The objective function value at a nearby.
+     */
+    double inPlaceSweep(double *,
+                        double *,
+                        const double,
+                        const unsigned int,
+                        FunEvals *);
 
 public:
     /**
@@ -126,13 +394,927 @@ public:
                        const double,
                        const unsigned int);
 
-    /** Default constructor. */
-    Hooke();
+    /**
+     * Main optimization method.
+     * <br />
+     * <br />The same as above, but the function evaluations are counted
+     * into a caller-owned container (which is not reset beforehand).
+     *
+     * @param nVars   The number of variables.
+     * @param startPt The starting point coordinates.
+     * @param endPt   The ending point coordinates.
+     * @param rho     The rho value.
+     * @param epsilon The epsilon value.
+     * @param iterMax The maximum number of iterations.
+     * @param fe      The number of function evaluations container.
+     *
+     * @return The number of iterations used to find the local minimum.
+     */
+    unsigned int hooke(const unsigned int,
+                       const double *,
+                       double *,
+                       const double,
+                       const double,
+                       const unsigned int,
+                       FunEvals *);
+
+    /**
+     * Setter for <code>trace</code>.
+     *
+     * @param __trace Whether to print the per-iteration trace
+     *                to the standard output (on by default).
+     */
+    void setTrace(const bool);
+
+    /**
+     * Setter for <code>tracer</code>.
+     * <br />
+     * <br />The trace decides which iterations get reported, in which
+     * layout and where to; with none set, every iteration is printed
+     * as text to the standard output.
+     *
+     * @param __tracer The caller-owned trace, or <code>NULL</code>.
+     */
+    void setTracer(Trace *);
+
+    /**
+     * Setter for the exploratory move strategy.
+     * <br />
+     * <br />The concurrent strategies call the objective function
+     * from several threads at once, so it has to be thread-safe.
+     *
+     * @param __poll The exploratory move strategy.
+     * @param __pool The thread pool to evaluate the poll points on;
+     *               <code>NULL</code> evaluates them in the calling thread.
+     */
+    void setPoll(const PollMode, ThreadPool * = NULL);
+
+    /**
+     * Setter for <code>cache</code>.
+     * <br />
+     * <br />The cache is consulted by the opportunistic sweep only
+     * (the concurrent strategies bypass it). It has to be built
+     * for the same number of variables and is not cleared
+     * between the solves.
+     *
+     * @param __cache The objective function values cache,
+     *                or <code>NULL</code> to disable caching.
+     */
+    void setCache(EvalCache *);
+
+    /**
+     * Setter for <code>incremental</code>.
+     * <br />
+     * <br />When on, the opportunistic sweep evaluates the base point
+     * once from scratch, then every probe through the objective's
+     * <code>fDelta()</code> (or from scratch, if it has none), bypassing
+     * the cache. The values may differ from the full ones in the last
+     * bits, so the trajectory may slightly deviate.
+     *
+     * @param __incremental Whether to evaluate incrementally.
+     */
+    void setIncremental(const bool);
+
+    /**
+     * Setter for <code>earlyAbort</code>.
+     * <br />
+     * <br />When on, the opportunistic sweep evaluates every probe against
+     * the best value so far through the objective's <code>fBounded()</code>
+     * (or in full, if it has none), counting the abandoned evaluations
+     * as rejected rather than as function evaluations. The partial sums
+     * are accumulated in the order of the full ones, so the trajectory
+     * is the same.
+     *
+     * @param __earlyAbort Whether to abandon the hopeless probes early.
+     */
+    void setEarlyAbort(const bool);
+
+    /**
+     * Setter for <code>workspace</code>.
+     * <br />
+     * <br />The solves that fit the workspace (see
+     * <code>Workspace::fits()</code>; a complete poll needs one lane
+     * per pool worker) take their work arrays from it and allocate
+     * nothing; the others allocate a workspace of their own.
+     * The workspace must not be shared between concurrent solves.
+     *
+     * @param __workspace The solver workspace, or <code>NULL</code>.
+     */
+    void setWorkspace(Workspace *);
+
+    /**
+     * Setter for <code>inPlace</code>.
+     * <br />
+     * <br />When on (the default), the opportunistic sweeps probe
+     * the new point in place and keep a list of the coordinates that
+     * have moved off the base point, so that resetting the new point
+     * and the pattern moves only touch those: the work array traffic
+     * then scales with the accepted moves rather than with n.
+     * When off, the full-vector copies are made, as they used to be.
+     * The trajectory is the same either way.
+     *
+     * @param __inPlace Whether to sweep in place.
+     */
+    void setInPlace(const bool);
+
+    /**
+     * Constructor.
+     *
+     * @param __objective The objective function provider.
+     */
+    explicit Hooke(const Objective & = Objective());
 
     /** Destructor. */
     ~Hooke();
 };
 
+// Helper method vars(...).
+template<typename Objective, unsigned int N>
+inline unsigned int Hooke<Objective, N>::vars(
+    const unsigned int nVars) const {
+
+    return (N == DYNAMIC_VARS) ? nVars : N;
+}
+
+// Helper method evaluate(...).
+template<typename Objective, unsigned int N>
+inline double Hooke<Objective, N>::evaluate(const double *x,
+                                            const unsigned int n,
+                                            FunEvals *funEvals) {
+
+    double f;
+
+    if (cache == NULL) {
+        return objective.f(x, n, funEvals);
+    }
+
+    if (cache->lookup(x, &f)) {
+        funEvals->add(CACHE_HITS);
+
+        return f;
+    }
+
+    funEvals->add(CACHE_MISSES);
+
+    f = objective.f(x, n, funEvals);
+
+    cache->insert(x, f);
+
+    return f;
+}
+
+// Helper method probe(...).
+template<typename Objective, unsigned int N>
+inline double Hooke<Objective, N>::probe(const double *x,
+                                         const unsigned int n,
+                                         const double threshold,
+                                         FunEvals *funEvals) {
+
+    double f;
+    bool   rejected;
+
+    if (!earlyAbort) {
+        return evaluate(x, n, funEvals);
+    }
+
+    if (cache != NULL) {
+        if (cache->lookup(x, &f)) {
+            funEvals->add(CACHE_HITS);
+
+            return f;
+        }
+
+        funEvals->add(CACHE_MISSES);
+    }
+
+    f = Bounded<Objective>::f(objective, x, n, threshold, &rejected,
+                              funEvals);
+
+    if ((cache != NULL) && !rejected) {
+        cache->insert(x, f);
+    }
+
+    return f;
+}
+
+// Helper method traffic(...).
+template<typename Objective, unsigned int N>
+inline void Hooke<Objective, N>::traffic(FunEvals *funEvals,
+                                         const unsigned long long bytes) {
+
+    funEvals->add(BYTES_MOVED, bytes);
+}
+
+// Helper method touch(...).
+template<typename Objective, unsigned int N>
+inline void Hooke<Objective, N>::touch(const unsigned int i,
+                                       FunEvals *funEvals) {
+
+    unsigned char *marks = ws->getMarks();
+
+    if (marks[i] == 0) {
+        marks[i]                 = 1;
+        ws->getMoved()[nMoved++] = i;
+
+        traffic(funEvals, sizeof(unsigned char) + sizeof(unsigned int));
+    }
+}
+
+// Helper method bestNearby(...).
+template<typename Objective, unsigned int N>
+double Hooke<Objective, N>::bestNearby(double *delta,
+                                       double *point,
+                                       const double prevBest,
+                                       const unsigned int nVars,
+                                       FunEvals *funEvals) {
+
+    double minF;
+    double fTmp;
+
+    unsigned int i;
+    unsigned int accepted = 0;
+    unsigned int n        = vars(nVars);
+
+    double *z = ws->getZ();
+
+    funEvals->add(SWEEPS);
+
+    if (poll == POLL_COMPLETE) {
+        return completePoll(delta, point, prevBest, nVars, funEvals);
+    }
+
+    if (poll == POLL_SPECULATIVE) {
+        return speculativeSweep(delta, point, prevBest, nVars, funEvals);
+    }
+
+    if (incremental) {
+        return incrementalSweep(delta, point, prevBest, nVars, funEvals);
+    }
+
+    if (sparse) {
+        return inPlaceSweep(delta, point, prevBest, nVars, funEvals);
+    }
+
+    minF = prevBest;
+
+    for (i = 0; i < n; i++) {
+        z[i] = point[i];
+    }
+
+    for (i = 0; i < n; i++) {
+        z[i] = point[i] + delta[i];
+
+        fTmp = probe(z, n, minF, funEvals);
+
+        if (fTmp < minF) {
+            minF = fTmp;
+
+            accepted++;
+        } else {
+            delta[i] = 0.0 - delta[i];
+            z[i]     = point[i] + delta[i];
+
+            fTmp = probe(z, n, minF, funEvals);
+
+            if (fTmp < minF) {
+                minF = fTmp;
+
+                accepted++;
+            } else {
+                z[i] = point[i];
+            }
+        }
+    }
+
+    for (i = 0; i < n; i++) {
+        point[i] = z[i];
+    }
+
+    // The copy in and the copy back.
+    traffic(funEvals, 2ULL * n * sizeof(double));
+
+    funEvals->add(ACCEPTED_MOVES, accepted);
+    funEvals->add(REJECTED_MOVES, n - accepted);
+
+    return minF;
+}
+
+// Helper method completePoll(...).
+template<typename Objective, unsigned int N>
+double Hooke<Objective, N>::completePoll(double *delta,
+                                         double *point,
+                                         const double prevBest,
+                                         const unsigned int nVars,
+                                         FunEvals *funEvals) {
+
+    unsigned int c;
+    unsigned int p;
+    unsigned int best;
+    unsigned int n       = vars(nVars);
+    unsigned int nPoll   = 2 * n;
+    unsigned int nChunks = (pool == NULL) ? 1 : pool->size();
+
+    if (nChunks > nPoll) {
+        nChunks = nPoll;
+    }
+
+    double *fPoll = ws->getFPoll();
+
+    /*
+     * The poll points are split into contiguous chunks, one per worker.
+     * Poll point p is point[p / 2] + delta (even p) or - delta (odd p).
+     * Every chunk perturbs its own copy of the base point (a workspace
+     * lane); the evaluations are counted into the caller's (sharded)
+     * container right away.
+     */
+    std::function<void(unsigned int)> evalChunk = [&](const unsigned int k) {
+        double *z = ws->getZLane(k);
+
+        unsigned int i;
+        unsigned int q;
+        unsigned int lo = (k * nPoll) / nChunks;
+        unsigned int hi = ((k + 1) * nPoll) / nChunks;
+
+        for (i = 0; i < n; i++) {
+            z[i] = point[i];
+        }
+
+        for (q = lo; q < hi; q++) {
+            i = q / 2;
+
+            z[i] = (q % 2 == 0) ? (point[i] + delta[i])
+                                : (point[i] - delta[i]);
+
+            fPoll[q] = objective.f(z, n, funEvals);
+
+            z[i] = point[i];
+        }
+    };
+
+    if (pool == NULL) {
+        evalChunk(0);
+    } else {
+        for (c = 0; c < nChunks; c++) {
+            pool->submit([&evalChunk, c](const unsigned int) {
+                evalChunk(c);
+            });
+        }
+
+        pool->wait();
+    }
+
+    // The lane copies.
+    traffic(funEvals, 1ULL * nChunks * n * sizeof(double));
+
+    // Ties go to the lowest poll index, keeping the outcome deterministic.
+    best = 0;
+
+    for (p = 1; p < nPoll; p++) {
+        if (fPoll[p] < fPoll[best]) {
+            best = p;
+        }
+    }
+
+    if (!(fPoll[best] < prevBest)) {
+        funEvals->add(REJECTED_MOVES, n);
+
+        return prevBest;
+    }
+
+    funEvals->add(ACCEPTED_MOVES);
+    funEvals->add(REJECTED_MOVES, n - 1);
+
+    // Moving backwards flips the delta, just like the sequential sweep does.
+    if (best % 2 == 1) {
+        delta[best / 2] = 0.0 - delta[best / 2];
+    }
+
+    point[best / 2] += delta[best / 2];
+
+    return fPoll[best];
+}
+
+// Helper method speculativeSweep(...).
+template<typename Objective, unsigned int N>
+double Hooke<Objective, N>::speculativeSweep(double *delta,
+                                             double *point,
+                                             const double prevBest,
+                                             const unsigned int nVars,
+                                             FunEvals *funEvals) {
+
+    double minF;
+    double fTmp;
+    double fMinus;
+
+    unsigned int i;
+    unsigned int accepted = 0;
+    unsigned int n        = vars(nVars);
+
+    double *z      = ws->getZ();
+    double *zMinus = ws->getZMinus();
+
+    minF = prevBest;
+
+    /*
+     * zMinus mirrors z everywhere but at the coordinate being probed,
+     * so that the -delta probe does not race with the +delta one.
+     */
+    for (i = 0; i < n; i++) {
+        z[i] = zMinus[i] = point[i];
+    }
+
+    for (i = 0; i < n; i++) {
+        z[i]      = point[i] + delta[i];
+        zMinus[i] = point[i] - delta[i];
+
+        std::function<void(unsigned int)> probeMinus
+            = [&](const unsigned int) {
+
+            fMinus = objective.f(zMinus, n, funEvals);
+        };
+
+        if (pool != NULL) {
+            pool->submit(probeMinus);
+        }
+
+        fTmp = objective.f(z, n, funEvals);
+
+        if (pool != NULL) {
+            pool->wait();
+        } else {
+            probeMinus(0);
+        }
+
+        // The -delta probe is an evaluation only if it was needed.
+        if (fTmp < minF) {
+            minF = fTmp;
+
+            funEvals->move(FUN_EVALS, WASTED_EVALS);
+
+            accepted++;
+        } else {
+            delta[i] = 0.0 - delta[i];
+            z[i]     = zMinus[i];
+
+            if (fMinus < minF) {
+                minF = fMinus;
+
+                accepted++;
+            } else {
+                z[i] = point[i];
+            }
+        }
+
+        zMinus[i] = z[i];
+    }
+
+    for (i = 0; i < n; i++) {
+        point[i] = z[i];
+    }
+
+    // The two copies in and the copy back.
+    traffic(funEvals, 3ULL * n * sizeof(double));
+
+    funEvals->add(ACCEPTED_MOVES, accepted);
+    funEvals->add(REJECTED_MOVES, n - accepted);
+
+    return minF;
+}
+
+// Helper method incrementalSweep(...).
+template<typename Objective, unsigned int N>
+double Hooke<Objective, N>::incrementalSweep(double *delta,
+                                             double *point,
+                                             const double prevBest,
+                                             const unsigned int nVars,
+                                             FunEvals *funEvals) {
+
+    double minF;
+    double fZ;
+    double fTmp;
+
+    unsigned int i;
+    unsigned int accepted = 0;
+    unsigned int n        = vars(nVars);
+
+    minF = prevBest;
+
+    /*
+     * prevBest is not necessarily f(point) (after a pattern move it is
+     * the value at the previous base), so the sweep starts off one full
+     * evaluation; from then on fZ tracks f(point) probe by probe.
+     * The point is probed in place: point[i] is the old value
+     * until the probes of coordinate i are resolved.
+     */
+    fZ = objective.f(point, n, funEvals);
+
+    unsigned char *marks = ws->getMarks();
+
+    for (i = 0; i < n; i++) {
+        double xOld = point[i];
+
+        // The deferred part of the pattern move (see inPlaceSweep()).
+        if (flipPending && (marks[i] == 0) && (delta[i] > 0.0)) {
+            delta[i] = 0.0 - std::fabs(delta[i]);
+
+            traffic(funEvals, sizeof(double));
+        }
+
+        point[i] = xOld + delta[i];
+
+        fTmp = Incremental<Objective>::f(objective, point, n, fZ, i, xOld,
+                                         point[i], funEvals);
+
+        if (fTmp < minF) {
+            minF = fTmp;
+
+            accepted++;
+            fZ   = fTmp;
+        } else {
+            delta[i] = 0.0 - delta[i];
+            point[i] = xOld + delta[i];
+
+            fTmp = Incremental<Objective>::f(objective, point, n, fZ, i, xOld,
+                                             point[i], funEvals);
+
+            if (fTmp < minF) {
+                minF = fTmp;
+
+                accepted++;
+                fZ   = fTmp;
+            } else {
+                point[i] = xOld;
+            }
+        }
+
+        if (sparse && (point[i] != xOld)) {
+            touch(i, funEvals);
+        }
+    }
+
+    flipPending = false;
+
+    funEvals->add(ACCEPTED_MOVES, accepted);
+    funEvals->add(REJECTED_MOVES, n - accepted);
+
+    return minF;
+}
+
+// Helper method inPlaceSweep(...).
+template<typename Objective, unsigned int N>
+double Hooke<Objective, N>::inPlaceSweep(double *delta,
+                                         double *point,
+                                         const double prevBest,
+                                         const unsigned int nVars,
+                                         FunEvals *funEvals) {
+
+    double minF;
+    double fTmp;
+
+    unsigned int i;
+    unsigned int accepted = 0;
+    unsigned int n        = vars(nVars);
+
+    unsigned char *marks = ws->getMarks();
+
+    minF = prevBest;
+
+    /*
+     * The point is probed in place: point[i] is the old value
+     * until the probes of coordinate i are resolved, and is put back
+     * if neither of them is any better.
+     */
+    for (i = 0; i < n; i++) {
+        double xOld = point[i];
+
+        /*
+         * A sparse pattern move leaves the coordinates off the moved list
+         * alone; but a dense one would have made their delta negative
+         * (as they did not move), so that is done here, on the way.
+         */
+        if (flipPending && (marks[i] == 0) && (delta[i] > 0.0)) {
+            delta[i] = 0.0 - std::fabs(delta[i]);
+
+            traffic(funEvals, sizeof(double));
+        }
+
+        point[i] = xOld + delta[i];
+
+        fTmp = probe(point, n, minF, funEvals);
+
+        if (fTmp < minF) {
+            minF = fTmp;
+
+            accepted++;
+
+            touch(i, funEvals);
+        } else {
+            delta[i] = 0.0 - delta[i];
+            point[i] = xOld + delta[i];
+
+            fTmp = probe(point, n, minF, funEvals);
+
+            if (fTmp < minF) {
+                minF = fTmp;
+
+                accepted++;
+
+                touch(i, funEvals);
+            } else {
+                point[i] = xOld;
+            }
+        }
+    }
+
+    flipPending = false;
+
+    funEvals->add(ACCEPTED_MOVES, accepted);
+    funEvals->add(REJECTED_MOVES, n - accepted);
+
+    return minF;
+}
+
+// Main optimization method hooke(...).
+template<typename Objective, unsigned int N>
+unsigned int Hooke<Objective, N>::hooke(const unsigned int nVars,
+                                        const double *startPt,
+                                        double *endPt,
+                                        const double rho,
+                                        const double epsilon,
+                                        const unsigned int iterMax) {
+
+    // The counter of this solve only; constructing one allocates its shards,
+    // so the callers running many solves pass theirs in instead.
+    FunEvals fe;
+
+    return hooke(nVars, startPt, endPt, rho, epsilon, iterMax, &fe);
+}
+
+// Main optimization method hooke(...) (caller-owned FunEvals).
+template<typename Objective, unsigned int N>
+unsigned int Hooke<Objective, N>::hooke(const unsigned int nVars,
+                                        const double *startPt,
+                                        double *endPt,
+                                        const double rho,
+                                        const double epsilon,
+                                        const unsigned int iterMax,
+                                        FunEvals *fe) {
+
+    unsigned int i;
+    unsigned int iAdj;
+    unsigned int iters;
+    unsigned int j;
+    unsigned int keep;
+    unsigned int nVisit;
+    unsigned int n     = vars(nVars);
+    unsigned int lanes = ((poll == POLL_COMPLETE) && (pool != NULL))
+                       ? pool->size() : 1;
+
+    double stepLength;
+    double fBefore;
+    double newF;
+    double tmp;
+
+    Trace *t = !trace ? NULL : (tracer != NULL) ? tracer : &textTrace;
+
+    // Taking the work arrays from the caller's workspace, if it fits.
+    Workspace *own = NULL;
+
+    if ((workspace != NULL) && workspace->fits(n, lanes)) {
+        ws = workspace;
+    } else {
+        ws = own = new Workspace(n, lanes);
+    }
+
+    double *newX    = ws->getNewX();
+    double *xBefore = ws->getXBefore();
+    double *delta   = ws->getDelta();
+
+    unsigned int  *moved = ws->getMoved();
+    unsigned char *marks = ws->getMarks();
+
+    // The moved coordinates list only serves the opportunistic sweeps.
+    sparse      = inPlace && (poll == POLL_OPPORTUNISTIC);
+    flipPending = false;
+    nMoved      = 0;
+
+    for (i = 0; i < n; i++) {
+        newX[i] = xBefore[i] = startPt[i];
+
+        delta[i] = std::fabs(startPt[i] * rho);
+
+        if (delta[i] == 0.0) {
+            delta[i] = rho;
+        }
+    }
+
+    iAdj       = 0;
+    stepLength = rho;
+    iters      = 0;
+
+    fBefore = evaluate(newX, n, fe);
+
+    newF = fBefore;
+
+    while ((iters < iterMax) && (stepLength > epsilon)) {
+        iters++;
+        iAdj++;
+
+        if ((t != NULL) && t->wants(iters)) {
+            t->iteration(iters, fe->getFunEvals(), fBefore, xBefore, n);
+        }
+
+        // Find best new point, one coord at a time.
+        if (sparse) {
+            // Only the moved coordinates differ from the base point.
+            for (j = 0; j < nMoved; j++) {
+                newX[moved[j]]  = xBefore[moved[j]];
+                marks[moved[j]] = 0;
+            }
+
+            traffic(fe, nMoved * (sizeof(double) + sizeof(unsigned char)));
+
+            nMoved = 0;
+        } else {
+            for (i = 0; i < n; i++) {
+                newX[i] = xBefore[i];
+            }
+
+            traffic(fe, 1ULL * n * sizeof(double));
+        }
+
+        newF = bestNearby(delta, newX, fBefore, n, fe);
+
+        // If we made some improvements, pursue that direction.
+        keep = 1;
+
+        while ((newF < fBefore) && (keep == 1)) {
+            iAdj = 0;
+
+            /*
+             * With the moved coordinates list, only the listed coordinates
+             * are visited: the others have newX[i] == xBefore[i], so they
+             * stay put, and their delta sign is left to the next sweep.
+             */
+            nVisit = sparse ? nMoved : n;
+
+            for (j = 0; j < nVisit; j++) {
+                i = sparse ? moved[j] : j;
+
+                // Firstly, arrange the sign of delta[].
+                if (newX[i] <= xBefore[i]) {
+                    delta[i] = 0.0 - std::fabs(delta[i]);
+                } else {
+                    delta[i] = std::fabs(delta[i]);
+                }
+
+                // Now, move further in this direction.
+                tmp        = xBefore[i];
+                xBefore[i] = newX[i];
+                newX[i]    = newX[i] + newX[i] - tmp;
+            }
+
+            traffic(fe, 3ULL * nVisit * sizeof(double));
+
+            flipPending = sparse;
+
+            fe->add(PATTERN_MOVES);
+
+            fBefore = newF;
+
+            newF = bestNearby(delta, newX, fBefore, n, fe);
+
+            // If the further (optimistic) move was bad....
+            if (newF >= fBefore) {
+                break;
+            }
+
+            /*
+             * Make sure that the differences between the new and the old
+             * points are due to actual displacements; beware of roundoff
+             * errors that might cause newF < fBefore.
+             */
+            keep = 0;
+
+            nVisit = sparse ? nMoved : n;
+
+            for (j = 0; j < nVisit; j++) {
+                i    = sparse ? moved[j] : j;
+                keep = 1;
+
+                if (std::fabs(newX[i] - xBefore[i])
+                    > (ZERO_POINT_FIVE * std::fabs(delta[i]))) {
+
+                    break;
+                } else {
+                    keep = 0;
+                }
+            }
+        }
+
+        if ((stepLength >= epsilon) && (newF >= fBefore)) {
+            stepLength = stepLength * rho;
+
+            for (i = 0; i < n; i++) {
+                delta[i] *= rho;
+            }
+
+            traffic(fe, 1ULL * n * sizeof(double));
+        }
+    }
+
+    for (i = 0; i < n; i++) {
+        endPt[i] = xBefore[i];
+    }
+
+    if (t != NULL) {
+        t->summary(iters, fe->getFunEvals(), fBefore, xBefore, n);
+        t->flush();
+    }
+
+    // Leaving the marks clear for the next solve on the workspace.
+    for (j = 0; j < nMoved; j++) {
+        marks[moved[j]] = 0;
+    }
+
+    ws = NULL;
+
+    delete own;
+
+    return iters;
+}
+
+// Setter for trace.
+template<typename Objective, unsigned int N>
+void Hooke<Objective, N>::setTrace(const bool __trace) {
+    trace = __trace;
+}
+
+// Setter for tracer.
+template<typename Objective, unsigned int N>
+void Hooke<Objective, N>::setTracer(Trace *__tracer) {
+    tracer = __tracer;
+}
+
+// Setter for the exploratory move strategy.
+template<typename Objective, unsigned int N>
+void Hooke<Objective, N>::setPoll(const PollMode __poll, ThreadPool *__pool) {
+    poll = __poll;
+    pool = __pool;
+}
+
+// Setter for cache.
+template<typename Objective, unsigned int N>
+void Hooke<Objective, N>::setCache(EvalCache *__cache) {
+    cache = __cache;
+}
+
+// Setter for incremental.
+template<typename Objective, unsigned int N>
+void Hooke<Objective, N>::setIncremental(const bool __incremental) {
+    incremental = __incremental;
+}
+
+// Setter for earlyAbort.
+template<typename Objective, unsigned int N>
+void Hooke<Objective, N>::setEarlyAbort(const bool __earlyAbort) {
+    earlyAbort = __earlyAbort;
+}
+
+// Setter for workspace.
+template<typename Objective, unsigned int N>
+void Hooke<Objective, N>::setWorkspace(Workspace *__workspace) {
+    workspace = __workspace;
+}
+
+// Setter for inPlace.
+template<typename Objective, unsigned int N>
+void Hooke<Objective, N>::setInPlace(const bool __inPlace) {
+    inPlace = __inPlace;
+}
+
+// Constructor.
+template<typename Objective, unsigned int N>
+Hooke<Objective, N>::Hooke(const Objective &__objective)
+    : objective(__objective),
+      trace(true),
+      tracer(NULL),
+      poll(POLL_OPPORTUNISTIC),
+      pool(NULL),
+      cache(NULL),
+      incremental(false),
+      earlyAbort(false),
+      workspace(NULL),
+      ws(NULL),
+      inPlace(true),
+      sparse(false),
+      flipPending(false),
+      nMoved(0) {}
+
+// Destructor.
+template<typename Objective, unsigned int N>
+Hooke<Objective, N>::~Hooke() {}
+
 } // namespace NLPUCCLIHooke
 
 #endif // __CC__HOOKE_H
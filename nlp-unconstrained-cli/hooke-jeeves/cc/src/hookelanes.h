@@ -0,0 +1,647 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/hookelanes.h
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#ifndef __CC__HOOKELANES_H
+#define __CC__HOOKELANES_H
+
+#include <vector>
+
+#include "hooke.h"
+
+/**
+ * The <code>NLPUCCLIHooke</code> namespace is used as a container
+ * for the <code>HookeLanes</code> class.
+ */
+namespace NLPUCCLIHooke {
+
+/** Constants. The number of lanes filling one AVX2, one AVX-512 vector. */
+const unsigned int LANES_AVX2   = 4;
+const unsigned int LANES_AVX512 = 8;
+
+/** Constant. The number of lanes filling two AVX-512 vectors. */
+const unsigned int LANES_WIDE = 16;
+
+/** Constant. The default number of lanes. */
+const unsigned int DEFAULT_LANES = LANES_AVX512;
+
+/** The step a lane is at, as of the end of a sweep. */
+enum LanePhase {
+    /** No problem in the lane. */
+    LANE_IDLE,
+
+    /** The lane has just swept around its base point. */
+    LANE_EXPLORE,
+
+    /** The lane has just swept around a pattern move point. */
+    LANE_PATTERN
+};
+
+/**
+ * The <code>HookeLanes</code> class template solves many independent
+ * problems of the same shape with the algorithm of Hooke and Jeeves,
+ * advancing <code>L</code> of them in lockstep, one per vector lane.
+ * <br />
+ * <br />All the points of the lanes are kept as structure-of-arrays
+ * (coordinate i of lane k at <code>[i * L + k]</code>), so that
+ * the +delta and -delta probes of a coordinate in the sequential
+ * opportunistic sweep are a single batch evaluation of <code>2L</code>
+ * points (see <code>HasFBatch</code>).
+ * Every lane sweeps once per round; the accept/reject decision,
+ * the pattern move and the termination test are taken per lane.
+ * A lane whose problem is done picks up the next pending one,
+ * so the lanes stay busy until the queue runs dry.
+ * <br />
+ * <br />The trajectory of each problem (and thus its ending point, number
+ * of iterations and number of function evaluations) is exactly the one
+ * <code>Hooke</code> takes with its default, opportunistic sweep.
+ *
+ * @param Objective The class providing the objective function.
+ * @param L         The number of lanes (4, 8 or 16 fill one AVX2,
+ *                  one AVX-512 or two AVX-512 vectors, respectively).
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @see     Hooke
+ * @see     Batched
+ * @since   hooke-jeeves 0.1
+ */
+template<typename Objective, unsigned int L = DEFAULT_LANES>
+class HookeLanes {
+private:
+    /** The objective function provider. */
+    Objective objective;
+
+    /** The number of variables of the solves in progress. */
+    unsigned int nVars;
+
+    /** The rho value of the solves in progress. */
+    double rho;
+
+    /** The epsilon value of the solves in progress. */
+    double epsilon;
+
+    /** The maximum number of iterations of the solves in progress. */
+    unsigned int iterMax;
+
+    /** The next pending problem. */
+    unsigned int next;
+
+    /** The ending points coordinates of the solves in progress. */
+    double *endPts;
+
+    /** The number of iterations per problem of the solves in progress. */
+    unsigned int *iters;
+
+    /** The number of function evaluations per problem (ditto). */
+    unsigned int *evals;
+
+    /** The objective function value at each ending point (ditto). */
+    double *fEnd;
+
+    /** The base points of the lanes (nVars rows of L). */
+    std::vector<double> xBefore;
+
+    /** The current points of the lanes (the same layout). */
+    std::vector<double> newX;
+
+    /** The steps of the lanes (the same layout). */
+    std::vector<double> delta;
+
+    /**
+     * The probe points of the lanes (nVars rows of 2 * L: the +delta,
+     * then the -delta probes).
+     */
+    std::vector<double> z;
+
+    /** The room for gathering one point. */
+    std::vector<double> scratch;
+
+    /** The objective function values at the probe points. */
+    double fTmp[2 * L];
+
+    /** The best values found by the sweeps in progress. */
+    double minF[L];
+
+    /** The objective function values at the base points. */
+    double fBefore[L];
+
+    /** The objective function values at the current points. */
+    double newF[L];
+
+    /** The step lengths. */
+    double stepLength[L];
+
+    /** The number of iterations of the problems in the lanes. */
+    unsigned int laneIters[L];
+
+    /** The number of function evaluations of the problems in the lanes. */
+    unsigned int laneEvals[L];
+
+    /** The problems in the lanes. */
+    unsigned int problem[L];
+
+    /** The steps the lanes are at. */
+    LanePhase phase[L];
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Loads a problem into a lane and evaluates its starting point.
+     *
+     * @param k         The lane.
+     * @param p         The problem.
+     * @param startPt   The starting point coordinates.
+     * @param funEvals  The number of function evaluations counter.
+     */
+    void load(const unsigned int,
+              const unsigned int,
+              const double *,
+              FunEvals *);
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Stores the ending point of the problem in a lane.
+     *
+     * @param k The lane.
+     */
+    void store(const unsigned int);
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Loads the next pending problem into a lane and starts it
+     * (storing right away the ones that need no iterations at all).
+     *
+     * @param k         The lane.
+     * @param nProblems The number of problems.
+     * @param startPts  The starting points coordinates.
+     * @param funEvals  The number of function evaluations counter.
+     *
+     * @return <code>true</code> if the lane has got a problem to sweep.
+     */
+    bool refill(const unsigned int,
+                const unsigned int,
+                const double *,
+                FunEvals *);
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Starts the next iteration of a lane, unless its problem is done.
+     *
+     * @param k The lane.
+     *
+     * @return <code>true</code> if the lane has to sweep.
+     */
+    bool startIter(const unsigned int);
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Makes the pattern move of a lane, pursuing the direction
+     * its last sweep has improved along.
+     *
+     * @param k The lane.
+     */
+    void patternMove(const unsigned int);
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Takes a lane from the end of its sweep to the start
+     * of the next one, in the same way as <code>Hooke::hooke()</code>.
+     *
+     * @param k The lane.
+     *
+     * @return <code>true</code> if the lane has to sweep.
+     */
+    bool advance(const unsigned int);
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Given the current points, looks for better ones nearby,
+     * one coord at a time, in all the busy lanes at once.
+     *
+     * @param funEvals  The number of function evaluations counter.
+     */
+    void sweep(FunEvals *);
+
+public:
+    /**
+     * Main optimization method.
+     * <br />
+     * <br />Solves the problem from each of the starting points.
+     * <br />
+     * <br />The function evaluations of all the lanes are counted into
+     * <code>fe</code> (which is not reset beforehand); those made
+     * in the idle lanes, or on the -delta side of the lanes that do not
+     * need them, are counted as wasted.
+     *
+     * @param nVars     The number of variables.
+     * @param nProblems The number of starting points.
+     * @param startPts  The starting points coordinates
+     *                  (<code>nProblems</code> rows of <code>nVars</code>).
+     * @param endPts    The ending points coordinates (the same layout).
+     * @param rho       The rho value.
+     * @param epsilon   The epsilon value.
+     * @param iterMax   The maximum number of iterations.
+     * @param iters     The number of iterations per problem (output).
+     * @param evals     The number of function evaluations per problem
+     *                  (output).
+     * @param fEnd      The objective function value at each ending point
+     *                  (output).
+     * @param fe        The number of function evaluations container.
+     *
+     * @return The number of rounds (lockstep sweeps) made.
+     */
+    unsigned int hookeLanes(const unsigned int,
+                            const unsigned int,
+                            const double *,
+                            double *,
+                            const double,
+                            const double,
+                            const unsigned int,
+                            unsigned int *,
+                            unsigned int *,
+                            double *,
+                            FunEvals *);
+
+    /**
+     * Constructor.
+     *
+     * @param __objective The objective function provider.
+     */
+    explicit HookeLanes(const Objective & = Objective());
+
+    /** Destructor. */
+    ~HookeLanes();
+};
+
+// Helper method load(...).
+template<typename Objective, unsigned int L>
+void HookeLanes<Objective, L>::load(const unsigned int k,
+                                    const unsigned int p,
+                                    const double *startPt,
+                                    FunEvals *funEvals) {
+
+    unsigned int i;
+    unsigned int n = nVars;
+
+    for (i = 0; i < n; i++) {
+        newX[i * L + k] = xBefore[i * L + k] = startPt[i];
+
+        delta[i * L + k] = std::fabs(startPt[i] * rho);
+
+        if (delta[i * L + k] == 0.0) {
+            delta[i * L + k] = rho;
+        }
+    }
+
+    stepLength[k] = rho;
+    laneIters[k]  = 0;
+    laneEvals[k]  = 1;
+    problem[k]    = p;
+
+    fBefore[k] = objective.f(startPt, n, funEvals);
+
+    newF[k] = fBefore[k];
+}
+
+// Helper method store(...).
+template<typename Objective, unsigned int L>
+void HookeLanes<Objective, L>::store(const unsigned int k) {
+    unsigned int i;
+    unsigned int p = problem[k];
+
+    for (i = 0; i < nVars; i++) {
+        endPts[p * nVars + i] = xBefore[i * L + k];
+    }
+
+    iters[p] = laneIters[k];
+    evals[p] = laneEvals[k];
+    fEnd[p]  = fBefore[k];
+}
+
+// Helper method refill(...).
+template<typename Objective, unsigned int L>
+bool HookeLanes<Objective, L>::refill(const unsigned int k,
+                                      const unsigned int nProblems,
+                                      const double *startPts,
+                                      FunEvals *funEvals) {
+
+    while (next < nProblems) {
+        load(k, next, startPts + next * nVars, funEvals);
+
+        next++;
+
+        if (startIter(k)) {
+            return true;
+        }
+
+        store(k);
+    }
+
+    return false;
+}
+
+// Helper method startIter(...).
+template<typename Objective, unsigned int L>
+bool HookeLanes<Objective, L>::startIter(const unsigned int k) {
+    unsigned int i;
+
+    if ((laneIters[k] >= iterMax) || (stepLength[k] <= epsilon)) {
+        phase[k] = LANE_IDLE;
+
+        return false;
+    }
+
+    laneIters[k]++;
+
+    for (i = 0; i < nVars; i++) {
+        newX[i * L + k] = xBefore[i * L + k];
+    }
+
+    phase[k] = LANE_EXPLORE;
+
+    return true;
+}
+
+// Helper method patternMove(...).
+template<typename Objective, unsigned int L>
+void HookeLanes<Objective, L>::patternMove(const unsigned int k) {
+    unsigned int i;
+    unsigned int j;
+
+    double tmp;
+
+    for (i = 0; i < nVars; i++) {
+        j = i * L + k;
+
+        // Firstly, arrange the sign of delta[].
+        if (newX[j] <= xBefore[j]) {
+            delta[j] = 0.0 - std::fabs(delta[j]);
+        } else {
+            delta[j] = std::fabs(delta[j]);
+        }
+
+        // Now, move further in this direction.
+        tmp        = xBefore[j];
+        xBefore[j] = newX[j];
+        newX[j]    = newX[j] + newX[j] - tmp;
+    }
+
+    fBefore[k] = newF[k];
+
+    phase[k] = LANE_PATTERN;
+}
+
+// Helper method advance(...).
+template<typename Objective, unsigned int L>
+bool HookeLanes<Objective, L>::advance(const unsigned int k) {
+    unsigned int i;
+    unsigned int keep;
+
+    if (phase[k] == LANE_EXPLORE) {
+        // If we made some improvements, pursue that direction.
+        if (newF[k] < fBefore[k]) {
+            patternMove(k);
+
+            return true;
+        }
+    } else if (newF[k] < fBefore[k]) {
+        /*
+         * Make sure that the differences between the new and the old
+         * points are due to actual displacements; beware of roundoff
+         * errors that might cause newF < fBefore.
+         */
+        keep = 0;
+
+        for (i = 0; i < nVars; i++) {
+            keep = 1;
+
+            if (std::fabs(newX[i * L + k] - xBefore[i * L + k])
+                > (ZERO_POINT_FIVE * std::fabs(delta[i * L + k]))) {
+
+                break;
+            } else {
+                keep = 0;
+            }
+        }
+
+        if (keep == 1) {
+            patternMove(k);
+
+            return true;
+        }
+    }
+
+    if ((stepLength[k] >= epsilon) && (newF[k] >= fBefore[k])) {
+        stepLength[k] = stepLength[k] * rho;
+
+        for (i = 0; i < nVars; i++) {
+            delta[i * L + k] *= rho;
+        }
+    }
+
+    return startIter(k);
+}
+
+// Helper method sweep(...).
+template<typename Objective, unsigned int L>
+void HookeLanes<Objective, L>::sweep(FunEvals *funEvals) {
+    unsigned int i;
+    unsigned int k;
+    unsigned int busy     = 0;
+    unsigned int accepted = 0;
+    unsigned int retried  = 0;
+    unsigned int n        = nVars;
+
+    bool live[L];
+    bool plus;
+    bool minus;
+
+    double *zi;
+    double *xi;
+    double *di;
+
+    funEvals->add(SWEEPS);
+
+    for (k = 0; k < L; k++) {
+        minF[k] = fBefore[k];
+        live[k] = (phase[k] != LANE_IDLE);
+
+        busy += live[k];
+    }
+
+    for (i = 0; i < n; i++) {
+        for (k = 0; k < L; k++) {
+            z[i * 2 * L + k] = z[i * 2 * L + L + k] = newX[i * L + k];
+        }
+    }
+
+    /*
+     * Both the +delta and the -delta probes of all the lanes make
+     * a single batch, as in the speculative sweep; the -delta result
+     * of a lane only counts when its +delta probe has failed.
+     * The lanes are updated without branching on them: an idle lane
+     * never accepts, so its point stays put.
+     */
+    for (i = 0; i < n; i++) {
+        zi = &z[i * 2 * L];
+        xi = &newX[i * L];
+        di = &delta[i * L];
+
+        for (k = 0; k < L; k++) {
+            zi[k]     = xi[k] + di[k];
+            zi[L + k] = xi[k] - di[k];
+        }
+
+        Batched<Objective>::f(objective, &z[0], n, 2 * L, fTmp, &scratch[0],
+                              funEvals);
+
+        for (k = 0; k < L; k++) {
+            plus  = live[k] && (fTmp[k] < minF[k]);
+            minus = live[k] && !plus && (fTmp[L + k] < minF[k]);
+
+            minF[k] = plus ? fTmp[k] : (minus ? fTmp[L + k] : minF[k]);
+            di[k]   = (live[k] && !plus) ? 0.0 - di[k] : di[k];
+            zi[k]   = plus ? zi[k] : (minus ? zi[L + k] : xi[k]);
+
+            zi[L + k] = zi[k];
+
+            laneEvals[k] += live[k] + (live[k] && !plus);
+
+            accepted += plus || minus;
+            retried  += live[k] && !plus;
+        }
+    }
+
+    for (i = 0; i < n; i++) {
+        for (k = 0; k < L; k++) {
+            newX[i * L + k] = z[i * 2 * L + k];
+        }
+    }
+
+    for (k = 0; k < L; k++) {
+        newF[k] = minF[k];
+    }
+
+    funEvals->move(FUN_EVALS, WASTED_EVALS,
+                   2ULL * L * n - (busy * n + retried));
+
+    funEvals->add(ACCEPTED_MOVES, accepted);
+    funEvals->add(REJECTED_MOVES, 1ULL * busy * n - accepted);
+}
+
+// Main optimization method hookeLanes(...).
+template<typename Objective, unsigned int L>
+unsigned int HookeLanes<Objective, L>::hookeLanes(const unsigned int nVars,
+                                                  const unsigned int nProblems,
+                                                  const double *startPts,
+                                                  double *endPts,
+                                                  const double rho,
+                                                  const double epsilon,
+                                                  const unsigned int iterMax,
+                                                  unsigned int *iters,
+                                                  unsigned int *evals,
+                                                  double *fEnd,
+                                                  FunEvals *fe) {
+
+    unsigned int k;
+    unsigned int busy   = 0;
+    unsigned int rounds = 0;
+
+    this->nVars   = nVars;
+    this->rho     = rho;
+    this->epsilon = epsilon;
+    this->iterMax = iterMax;
+    this->endPts  = endPts;
+    this->iters   = iters;
+    this->evals   = evals;
+    this->fEnd    = fEnd;
+
+    next = 0;
+
+    // The idle lanes keep being evaluated, so they hold finite points.
+    xBefore.assign(nVars * L, 0.0);
+    newX.assign(nVars * L, 0.0);
+    delta.assign(nVars * L, 0.0);
+    z.assign(nVars * 2 * L, 0.0);
+    scratch.assign(nVars, 0.0);
+
+    for (k = 0; k < L; k++) {
+        phase[k]   = LANE_IDLE;
+        fBefore[k] = 0.0;
+
+        if (refill(k, nProblems, startPts, fe)) {
+            busy++;
+        }
+    }
+
+    while (busy > 0) {
+        sweep(fe);
+
+        rounds++;
+
+        for (k = 0; k < L; k++) {
+            if ((phase[k] == LANE_IDLE) || advance(k)) {
+                continue;
+            }
+
+            // The problem in the lane is done: picking up the next one.
+            store(k);
+
+            if (!refill(k, nProblems, startPts, fe)) {
+                busy--;
+            }
+        }
+    }
+
+    return rounds;
+}
+
+// Constructor.
+template<typename Objective, unsigned int L>
+HookeLanes<Objective, L>::HookeLanes(const Objective &__objective)
+    : objective(__objective),
+      nVars(0),
+      rho(0.0),
+      epsilon(0.0),
+      iterMax(0),
+      next(0),
+      endPts(NULL),
+      iters(NULL),
+      evals(NULL),
+      fEnd(NULL) {}
+
+// Destructor.
+template<typename Objective, unsigned int L>
+HookeLanes<Objective, L>::~HookeLanes() {}
+
+} // namespace NLPUCCLIHooke
+
+#endif // __CC__HOOKELANES_H
+
+// vim:set nu et ts=4 sw=4:
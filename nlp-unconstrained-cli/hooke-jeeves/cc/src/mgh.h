@@ -0,0 +1,655 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/mgh.h
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#ifndef __CC__MGH_H
+#define __CC__MGH_H
+
+#include "hooke.h"
+
+/**
+ * The <code>NLPUCCLIHooke</code> namespace is used as a container
+ * for the More, Garbow &amp; Hillstrom test problem classes.
+ * <br />
+ * <br />These are the unconstrained minimization problems of TOMS
+ * algorithm 566 (More, Garbow &amp; Hillstrom, &quot;Testing Unconstrained
+ * Optimization Software&quot;, ACM TOMS 7(1), 1981), numbers 1 to 18,
+ * but for the extended Rosenbrock (14) and the Wood (17) ones, which are
+ * the <code>Rosenbrock</code> and <code>Woods</code> classes. Every one
+ * of them is a sum of squares of m functions of n variables; where n
+ * may vary, <code>NVARS</code> is the value the paper reports f* for.
+ * Their starting guesses are the standard ones, set up in
+ * <code>main()</code>.
+ */
+namespace NLPUCCLIHooke {
+
+/** Helper constants (the problem data). */
+const double       MGH_TWO_PI          = 6.283185307179586;
+const unsigned int MGH_BIGGS_M         = 13;
+const unsigned int MGH_GAUSSIAN_M      = 15;
+const unsigned int MGH_BOX_M           = 10;
+const unsigned int MGH_WATSON_M        = 29;
+const double       MGH_PENALTY_A       = 1E-5;
+const unsigned int MGH_BROWN_DENNIS_M  = 20;
+const unsigned int MGH_GULF_M          = 99;
+const unsigned int MGH_BEALE_M         = 3;
+
+const double MGH_GAUSSIAN_Y[MGH_GAUSSIAN_M] = {
+    .0009, .0044, .0175, .0540, .1295, .2420, .3521, .3989,
+    .3521, .2420, .1295, .0540, .0175, .0044, .0009
+};
+
+const double MGH_BEALE_Y[MGH_BEALE_M] = {1.5, 2.25, 2.625};
+
+/** Problem 1: Helical valley (f* = 0 at (1, 0, 0)). */
+class HelicalValley {
+public:
+    /** Constant. The number of variables of the test problem. */
+    static const unsigned int NVARS = 3;
+
+    /** The objective function f(x,n) (see <code>Rosenbrock::f()</code>). */
+    static double f(const double *, const unsigned int, FunEvals *);
+};
+
+/** Problem 2: Biggs EXP6, m = 13 (f* = 0 at (1, 10, 1, 5, 4, 3)). */
+class BiggsExp6 {
+public:
+    /** Constant. The number of variables of the test problem. */
+    static const unsigned int NVARS = 6;
+
+    /** The objective function f(x,n) (see <code>Rosenbrock::f()</code>). */
+    static double f(const double *, const unsigned int, FunEvals *);
+};
+
+/** Problem 3: Gaussian, m = 15 (f* = 1.12793e-8). */
+class Gaussian {
+public:
+    /** Constant. The number of variables of the test problem. */
+    static const unsigned int NVARS = 3;
+
+    /** The objective function f(x,n) (see <code>Rosenbrock::f()</code>). */
+    static double f(const double *, const unsigned int, FunEvals *);
+};
+
+/** Problem 4: Powell badly scaled (f* = 0 at (1.098e-5, 9.106)). */
+class PowellBadlyScaled {
+public:
+    /** Constant. The number of variables of the test problem. */
+    static const unsigned int NVARS = 2;
+
+    /** The objective function f(x,n) (see <code>Rosenbrock::f()</code>). */
+    static double f(const double *, const unsigned int, FunEvals *);
+};
+
+/** Problem 5: Box three-dimensional, m = 10 (f* = 0 at (1, 10, 1)). */
+class Box3D {
+public:
+    /** Constant. The number of variables of the test problem. */
+    static const unsigned int NVARS = 3;
+
+    /** The objective function f(x,n) (see <code>Rosenbrock::f()</code>). */
+    static double f(const double *, const unsigned int, FunEvals *);
+};
+
+/** Problem 6: Variably dimensioned, m = n + 2 (f* = 0 at (1, ..., 1)). */
+class VariablyDimensioned {
+public:
+    /** Constant. The number of variables of the test problem. */
+    static const unsigned int NVARS = 10;
+
+    /** The objective function f(x,n) (see <code>Rosenbrock::f()</code>). */
+    static double f(const double *, const unsigned int, FunEvals *);
+};
+
+/** Problem 7: Watson, m = 31 (f* = 2.28767e-3 for n = 6). */
+class Watson {
+public:
+    /** Constant. The number of variables of the test problem. */
+    static const unsigned int NVARS = 6;
+
+    /** The objective function f(x,n) (see <code>Rosenbrock::f()</code>). */
+    static double f(const double *, const unsigned int, FunEvals *);
+};
+
+/** Problem 8: Penalty I, m = n + 1 (f* = 2.24997e-5 for n = 4). */
+class PenaltyI {
+public:
+    /** Constant. The number of variables of the test problem. */
+    static const unsigned int NVARS = 4;
+
+    /** The objective function f(x,n) (see <code>Rosenbrock::f()</code>). */
+    static double f(const double *, const unsigned int, FunEvals *);
+};
+
+/** Problem 9: Penalty II, m = 2n (f* = 9.37629e-6 for n = 4). */
+class PenaltyII {
+public:
+    /** Constant. The number of variables of the test problem. */
+    static const unsigned int NVARS = 4;
+
+    /** The objective function f(x,n) (see <code>Rosenbrock::f()</code>). */
+    static double f(const double *, const unsigned int, FunEvals *);
+};
+
+/** Problem 10: Brown badly scaled (f* = 0 at (1e6, 2e-6)). */
+class BrownBadlyScaled {
+public:
+    /** Constant. The number of variables of the test problem. */
+    static const unsigned int NVARS = 2;
+
+    /** The objective function f(x,n) (see <code>Rosenbrock::f()</code>). */
+    static double f(const double *, const unsigned int, FunEvals *);
+};
+
+/** Problem 11: Brown and Dennis, m = 20 (f* = 85822.2). */
+class BrownDennis {
+public:
+    /** Constant. The number of variables of the test problem. */
+    static const unsigned int NVARS = 4;
+
+    /** The objective function f(x,n) (see <code>Rosenbrock::f()</code>). */
+    static double f(const double *, const unsigned int, FunEvals *);
+};
+
+/** Problem 12: Gulf research and development, m = 99 (f* = 0). */
+class GulfResearch {
+public:
+    /** Constant. The number of variables of the test problem. */
+    static const unsigned int NVARS = 3;
+
+    /** The objective function f(x,n) (see <code>Rosenbrock::f()</code>). */
+    static double f(const double *, const unsigned int, FunEvals *);
+};
+
+/** Problem 13: Trigonometric, m = n (f* = 0). */
+class Trigonometric {
+public:
+    /** Constant. The number of variables of the test problem. */
+    static const unsigned int NVARS = 10;
+
+    /** The objective function f(x,n) (see <code>Rosenbrock::f()</code>). */
+    static double f(const double *, const unsigned int, FunEvals *);
+};
+
+/** Problem 15: Extended Powell singular, n % 4 = 0 (f* = 0 at 0). */
+class PowellSingular {
+public:
+    /** Constant. The number of variables of the test problem. */
+    static const unsigned int NVARS = 4;
+
+    /** The objective function f(x,n) (see <code>Rosenbrock::f()</code>). */
+    static double f(const double *, const unsigned int, FunEvals *);
+};
+
+/** Problem 16: Beale (f* = 0 at (3, 0.5)). */
+class Beale {
+public:
+    /** Constant. The number of variables of the test problem. */
+    static const unsigned int NVARS = 2;
+
+    /** The objective function f(x,n) (see <code>Rosenbrock::f()</code>). */
+    static double f(const double *, const unsigned int, FunEvals *);
+};
+
+/**
+ * Problem 18: Chebyquad, m = n (f* = 3.51687e-3 for n = 8).
+ * The number of variables is limited to <code>VARS</code>.
+ */
+class Chebyquad {
+public:
+    /** Constant. The number of variables of the test problem. */
+    static const unsigned int NVARS = 8;
+
+    /** The objective function f(x,n) (see <code>Rosenbrock::f()</code>). */
+    static double f(const double *, const unsigned int, FunEvals *);
+};
+
+// The objective function of problem 1.
+inline double HelicalValley::f(const double *x,
+                               const unsigned int n,
+                               FunEvals *funEvals) {
+
+    double theta;
+    double r1;
+    double r2;
+
+    funEvals->add(FUN_EVALS);
+
+    if (x[0] > 0) {
+        theta = std::atan(x[1] / x[0]) / MGH_TWO_PI;
+    } else if (x[0] < 0) {
+        theta = std::atan(x[1] / x[0]) / MGH_TWO_PI + .5;
+    } else {
+        theta = (x[1] < 0) ? -.25 : .25;
+    }
+
+    r1 = 10 * (x[2] - 10 * theta);
+    r2 = 10 * (std::sqrt(x[0] * x[0] + x[1] * x[1]) - 1);
+
+    return (r1 * r1 + r2 * r2 + x[2] * x[2]);
+}
+
+// The objective function of problem 2.
+inline double BiggsExp6::f(const double *x,
+                           const unsigned int n,
+                           FunEvals *funEvals) {
+
+    double s = 0.0;
+    double t;
+    double r;
+
+    unsigned int i;
+
+    funEvals->add(FUN_EVALS);
+
+    for (i = 1; i <= MGH_BIGGS_M; i++) {
+        t = .1 * i;
+
+        r = x[2] * std::exp(-t * x[0]) - x[3] * std::exp(-t * x[1])
+          + x[5] * std::exp(-t * x[4])
+          - (std::exp(-t) - 5 * std::exp(-10 * t) + 3 * std::exp(-4 * t));
+
+        s += r * r;
+    }
+
+    return s;
+}
+
+// The objective function of problem 3.
+inline double Gaussian::f(const double *x,
+                          const unsigned int n,
+                          FunEvals *funEvals) {
+
+    double s = 0.0;
+    double t;
+    double r;
+
+    unsigned int i;
+
+    funEvals->add(FUN_EVALS);
+
+    for (i = 0; i < MGH_GAUSSIAN_M; i++) {
+        t = (7.0 - i) / 2;
+        r = x[0] * std::exp(-x[1] * (t - x[2]) * (t - x[2]) / 2)
+          - MGH_GAUSSIAN_Y[i];
+
+        s += r * r;
+    }
+
+    return s;
+}
+
+// The objective function of problem 4.
+inline double PowellBadlyScaled::f(const double *x,
+                                   const unsigned int n,
+                                   FunEvals *funEvals) {
+
+    double r1;
+    double r2;
+
+    funEvals->add(FUN_EVALS);
+
+    r1 = 1E4 * x[0] * x[1] - 1;
+    r2 = std::exp(-x[0]) + std::exp(-x[1]) - 1.0001;
+
+    return (r1 * r1 + r2 * r2);
+}
+
+// The objective function of problem 5.
+inline double Box3D::f(const double *x,
+                       const unsigned int n,
+                       FunEvals *funEvals) {
+
+    double s = 0.0;
+    double t;
+    double r;
+
+    unsigned int i;
+
+    funEvals->add(FUN_EVALS);
+
+    for (i = 1; i <= MGH_BOX_M; i++) {
+        t = .1 * i;
+        r = std::exp(-t * x[0]) - std::exp(-t * x[1])
+          - x[2] * (std::exp(-t) - std::exp(-10 * t));
+
+        s += r * r;
+    }
+
+    return s;
+}
+
+// The objective function of problem 6.
+inline double VariablyDimensioned::f(const double *x,
+                                     const unsigned int n,
+                                     FunEvals *funEvals) {
+
+    double s = 0.0;
+    double v = 0.0;
+
+    unsigned int j;
+
+    funEvals->add(FUN_EVALS);
+
+    for (j = 0; j < n; j++) {
+        s += (x[j] - 1) * (x[j] - 1);
+        v += (j + 1) * (x[j] - 1);
+    }
+
+    return (s + v * v + (v * v) * (v * v));
+}
+
+// The objective function of problem 7.
+inline double Watson::f(const double *x,
+                        const unsigned int n,
+                        FunEvals *funEvals) {
+
+    double s = 0.0;
+    double t;
+    double d;
+    double s1;
+    double s2;
+    double r;
+
+    unsigned int i;
+    unsigned int j;
+
+    funEvals->add(FUN_EVALS);
+
+    for (i = 1; i <= MGH_WATSON_M; i++) {
+        t  = i / 29.0;
+        s1 = 0.0;
+        d  = 1.0;
+
+        for (j = 1; j < n; j++) {
+            s1 += j * x[j] * d;
+            d  *= t;
+        }
+
+        s2 = 0.0;
+        d  = 1.0;
+
+        for (j = 0; j < n; j++) {
+            s2 += x[j] * d;
+            d  *= t;
+        }
+
+        r  = s1 - s2 * s2 - 1;
+        s += r * r;
+    }
+
+    r = x[1] - x[0] * x[0] - 1;
+
+    return (s + x[0] * x[0] + r * r);
+}
+
+// The objective function of problem 8.
+inline double PenaltyI::f(const double *x,
+                          const unsigned int n,
+                          FunEvals *funEvals) {
+
+    double s = 0.0;
+    double v = 0.0;
+
+    unsigned int j;
+
+    funEvals->add(FUN_EVALS);
+
+    for (j = 0; j < n; j++) {
+        s += MGH_PENALTY_A * (x[j] - 1) * (x[j] - 1);
+        v += x[j] * x[j];
+    }
+
+    return (s + (v - .25) * (v - .25));
+}
+
+// The objective function of problem 9.
+inline double PenaltyII::f(const double *x,
+                           const unsigned int n,
+                           FunEvals *funEvals) {
+
+    double s;
+    double v = 0.0;
+    double r;
+
+    unsigned int j;
+
+    funEvals->add(FUN_EVALS);
+
+    s = (x[0] - .2) * (x[0] - .2);
+
+    for (j = 1; j < n; j++) {
+        r  = std::exp(x[j] / 10) + std::exp(x[j - 1] / 10)
+           - (std::exp((j + 1) / 10.0) + std::exp(j / 10.0));
+        s += MGH_PENALTY_A * r * r;
+
+        r  = std::exp(x[j] / 10) - std::exp(-.1);
+        s += MGH_PENALTY_A * r * r;
+    }
+
+    for (j = 0; j < n; j++) {
+        v += (n - j) * x[j] * x[j];
+    }
+
+    return (s + (v - 1) * (v - 1));
+}
+
+// The objective function of problem 10.
+inline double BrownBadlyScaled::f(const double *x,
+                                  const unsigned int n,
+                                  FunEvals *funEvals) {
+
+    double r1;
+    double r2;
+    double r3;
+
+    funEvals->add(FUN_EVALS);
+
+    r1 = x[0] - 1E6;
+    r2 = x[1] - 2E-6;
+    r3 = x[0] * x[1] - 2;
+
+    return (r1 * r1 + r2 * r2 + r3 * r3);
+}
+
+// The objective function of problem 11.
+inline double BrownDennis::f(const double *x,
+                             const unsigned int n,
+                             FunEvals *funEvals) {
+
+    double s = 0.0;
+    double t;
+    double u;
+    double v;
+    double r;
+
+    unsigned int i;
+
+    funEvals->add(FUN_EVALS);
+
+    for (i = 1; i <= MGH_BROWN_DENNIS_M; i++) {
+        t = i / 5.0;
+        u = x[0] + t * x[1] - std::exp(t);
+        v = x[2] + x[3] * std::sin(t) - std::cos(t);
+        r = u * u + v * v;
+
+        s += r * r;
+    }
+
+    return s;
+}
+
+// The objective function of problem 12.
+inline double GulfResearch::f(const double *x,
+                              const unsigned int n,
+                              FunEvals *funEvals) {
+
+    double s = 0.0;
+    double t;
+    double y;
+    double r;
+
+    unsigned int i;
+
+    funEvals->add(FUN_EVALS);
+
+    for (i = 1; i <= MGH_GULF_M; i++) {
+        t = i / 100.0;
+        y = 25 + std::pow(-50 * std::log(t), 2 / 3.0);
+        r = std::exp(-std::pow(std::fabs(y - x[1]), x[2]) / x[0]) - t;
+
+        s += r * r;
+    }
+
+    return s;
+}
+
+// The objective function of problem 13.
+inline double Trigonometric::f(const double *x,
+                               const unsigned int n,
+                               FunEvals *funEvals) {
+
+    double s = 0.0;
+    double c = 0.0;
+    double r;
+
+    unsigned int j;
+
+    funEvals->add(FUN_EVALS);
+
+    for (j = 0; j < n; j++) {
+        c += std::cos(x[j]);
+    }
+
+    for (j = 0; j < n; j++) {
+        r  = n - c + (j + 1) * (1 - std::cos(x[j])) - std::sin(x[j]);
+        s += r * r;
+    }
+
+    return s;
+}
+
+// The objective function of problem 15.
+inline double PowellSingular::f(const double *x,
+                                const unsigned int n,
+                                FunEvals *funEvals) {
+
+    double s = 0.0;
+    double r1;
+    double r2;
+    double r3;
+    double r4;
+
+    unsigned int k;
+
+    funEvals->add(FUN_EVALS);
+
+    for (k = 0; k + INDEX_THREE < n; k += 4) {
+        r1 = x[k]     + 10 * x[k + 1];
+        r2 = x[k + 2] -      x[k + 3];
+        r3 = x[k + 1] -  2 * x[k + 2];
+        r4 = x[k]     -      x[k + 3];
+
+        s += r1 * r1 + 5 * r2 * r2 + (r3 * r3) * (r3 * r3)
+                                   + 10 * (r4 * r4) * (r4 * r4);
+    }
+
+    return s;
+}
+
+// The objective function of problem 16.
+inline double Beale::f(const double *x,
+                       const unsigned int n,
+                       FunEvals *funEvals) {
+
+    double s = 0.0;
+    double d = 1.0;
+    double r;
+
+    unsigned int i;
+
+    funEvals->add(FUN_EVALS);
+
+    for (i = 0; i < MGH_BEALE_M; i++) {
+        d *= x[1];
+        r  = MGH_BEALE_Y[i] - x[0] * (1 - d);
+        s += r * r;
+    }
+
+    return s;
+}
+
+// The objective function of problem 18.
+inline double Chebyquad::f(const double *x,
+                           const unsigned int n,
+                           FunEvals *funEvals) {
+
+    double s = 0.0;
+    double a[VARS];
+    double y;
+    double t0;
+    double t1;
+    double t2;
+    double r;
+
+    unsigned int i;
+    unsigned int j;
+
+    funEvals->add(FUN_EVALS);
+
+    for (i = 0; i < n; i++) {
+        a[i] = 0.0;
+    }
+
+    // The shifted Chebyshev polynomials T1..Tn at every coordinate.
+    for (j = 0; j < n; j++) {
+        y  = 2 * x[j] - 1;
+        t0 = 1.0;
+        t1 = y;
+
+        for (i = 0; i < n; i++) {
+            a[i] += t1;
+            t2    = 2 * y * t1 - t0;
+            t0    = t1;
+            t1    = t2;
+        }
+    }
+
+    // Minus the integral over [0, 1]: -1 / (i^2 - 1) for an even i.
+    for (i = 1; i <= n; i++) {
+        r = a[i - 1] / n;
+
+        if (i % 2 == 0) {
+            r += 1.0 / ((double) i * i - 1);
+        }
+
+        s += r * r;
+    }
+
+    return s;
+}
+
+} // namespace NLPUCCLIHooke
+
+#endif // __CC__MGH_H
+
+// vim:set nu et ts=4 sw=4:
@@ -0,0 +1,167 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/microbench.cc
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#include <algorithm>
+#include <cstdio>
+
+#include "microbench.h"
+
+// The NLPUCCLIHooke namespace.
+namespace NLPUCCLIHooke {
+
+// Helper constants (the percentiles reported).
+const unsigned int MICRO_P50 = 50;
+const unsigned int MICRO_P90 = 90;
+const unsigned int MICRO_P   = 100;
+
+// Helper constant (the room for one formatted number).
+const unsigned int MICRO_NUMBER_SIZE = 32;
+
+// Helper function.
+// Picks the nearest-rank percentile of the sorted samples.
+static double percentile(const std::vector<double> &sorted,
+                         const unsigned int p) {
+
+    std::size_t rank = (sorted.size() * p + MICRO_P - 1) / MICRO_P;
+
+    return sorted[(rank == 0) ? 0 : rank - 1];
+}
+
+// Helper function.
+// Writes a string as a JSON one (quoted and escaped).
+static void jsonString(std::ostream &out, const std::string &s) {
+    char buf[MICRO_NUMBER_SIZE];
+
+    std::string::size_type i;
+
+    out << '"';
+
+    for (i = 0; i < s.size(); i++) {
+        unsigned char c = s[i];
+
+        if ((c == '"') || (c == '\\')) {
+            out << '\\' << c;
+        } else if (c < ' ') {
+            std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+
+            out << buf;
+        } else {
+            out << c;
+        }
+    }
+
+    out << '"';
+}
+
+// Helper function.
+// Writes a time member of a JSON object (at a fixed precision,
+// so that the diffs of two runs stay readable).
+static void jsonTime(std::ostream &out, const char *name, const double t) {
+    char buf[MICRO_NUMBER_SIZE];
+
+    std::snprintf(buf, sizeof(buf), "%.3f", t);
+
+    out << ", \"" << name << "\": " << buf;
+}
+
+// Helper method summarize(...).
+MicroStats MicroBench::summarize(const unsigned long long batch) {
+    MicroStats s;
+
+    std::sort(samples.begin(), samples.end());
+
+    s.batch  = batch;
+    s.reps   = samples.size();
+    s.min    = samples.front();
+    s.median = percentile(samples, MICRO_P50);
+    s.p90    = percentile(samples, MICRO_P90);
+    s.max    = samples.back();
+
+    return s;
+}
+
+// Getter for warmup.
+unsigned int MicroBench::getWarmup() const {
+    return warmup;
+}
+
+// Getter for reps.
+unsigned int MicroBench::getReps() const {
+    return reps;
+}
+
+// Constructor.
+MicroBench::MicroBench(const unsigned int __warmup,
+                       const unsigned int __reps,
+                       const double __minRep)
+    : warmup(__warmup),
+      reps((__reps == 0) ? 1 : __reps),
+      minRep(__minRep) {}
+
+// Writes the results of a benchmark run as a JSON document.
+void writeJson(std::ostream &out,
+               const std::string &label,
+               const MicroBench &bench,
+               const std::vector<MicroResult> &results) {
+
+    std::vector<MicroResult>::size_type k;
+
+    out << "{\n  \"label\": ";
+
+    jsonString(out, label);
+
+    out << ",\n  \"warmup\": " << bench.getWarmup()
+        << ",\n  \"reps\": "   << bench.getReps()
+        << ",\n  \"results\": [";
+
+    for (k = 0; k < results.size(); k++) {
+        const MicroResult &r = results[k];
+
+        out << ((k == 0) ? "\n" : ",\n") << "    {\"metric\": ";
+
+        jsonString(out, r.metric);
+
+        out << ", \"func\": ";
+
+        jsonString(out, r.func);
+
+        out << ", \"n\": " << r.nVars << ", \"unit\": ";
+
+        jsonString(out, r.unit);
+
+        out << ", \"batch\": " << r.stats.batch;
+
+        jsonTime(out, "min",    r.stats.min);
+        jsonTime(out, "median", r.stats.median);
+        jsonTime(out, "p90",    r.stats.p90);
+        jsonTime(out, "max",    r.stats.max);
+
+        out << "}";
+    }
+
+    out << "\n  ]\n}\n";
+}
+
+} // namespace NLPUCCLIHooke
+
+// vim:set nu et ts=4 sw=4:
@@ -0,0 +1,257 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/microbench.h
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#ifndef __CC__MICROBENCH_H
+#define __CC__MICROBENCH_H
+
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * The <code>NLPUCCLIHooke</code> namespace is used as a container
+ * for the <code>MicroBench</code> class.
+ */
+namespace NLPUCCLIHooke {
+
+/** Constant. The default number of untimed warm-up repetitions. */
+const unsigned int MICRO_WARMUP = 3;
+
+/** Constant. The default number of timed repetitions. */
+const unsigned int MICRO_REPS = 21;
+
+/** Constant. The shortest a timed repetition may take (in seconds). */
+const double MICRO_MIN_REP_SECONDS = 1E-3;
+
+/** Constant. The number of nanoseconds in a second. */
+const double NS_PER_SECOND = 1E9;
+
+/**
+ * The summary of the timed repetitions of a measured operation.
+ * <br />
+ * <br />The times are in nanoseconds per unit of work (an objective
+ * function call, an exploratory sweep, a solve), the percentiles
+ * are the nearest-rank ones over the repetitions. There is no 99th one:
+ * over the default <code>MICRO_REPS</code> repetitions it would just be
+ * the slowest one.
+ */
+struct MicroStats {
+    /** The number of operations in a repetition. */
+    unsigned long long batch;
+
+    /** The number of timed repetitions. */
+    unsigned int reps;
+
+    /** The fastest repetition. */
+    double min;
+
+    /** The median repetition. */
+    double median;
+
+    /** The 90th percentile. */
+    double p90;
+
+    /** The slowest repetition. */
+    double max;
+};
+
+/** One measurement of a benchmark run (a row of its report). */
+struct MicroResult {
+    /** The operation measured (<code>f</code>, <code>sweep</code>...). */
+    std::string metric;
+
+    /** The objective function name. */
+    std::string func;
+
+    /** The number of variables. */
+    unsigned int nVars;
+
+    /** The unit the times are given per (<code>ns/call</code>...). */
+    std::string unit;
+
+    /** The timings. */
+    MicroStats stats;
+};
+
+/**
+ * The <code>MicroBench</code> class is a micro-benchmark harness:
+ * it times an operation over a number of repetitions and summarizes
+ * the distribution of the time per unit of work.
+ * <br />
+ * <br />A run first calibrates the batch, doubling the number
+ * of operations in a repetition until one takes
+ * <code>minRep</code> seconds at least (so that the clock resolution
+ * does not show), then runs the untimed warm-up repetitions (caches,
+ * branch predictors, page faults of the work arrays), then the timed
+ * ones. Each operation reports the number of units of work it has done,
+ * so that an operation of a variable length (e.g. a short solve
+ * and the number of sweeps it took) is timed per unit.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @since   hooke-jeeves 0.1
+ */
+class MicroBench {
+private:
+    /** The number of untimed warm-up repetitions. */
+    unsigned int warmup;
+
+    /** The number of timed repetitions. */
+    unsigned int reps;
+
+    /** The shortest a timed repetition may take (in seconds). */
+    double minRep;
+
+    /** The time per unit of work of every timed repetition. */
+    std::vector<double> samples;
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Sorts the samples and summarizes them.
+     *
+     * @param batch The number of operations in a repetition.
+     *
+     * @return The timings.
+     */
+    MicroStats summarize(const unsigned long long);
+
+    /** Copying is not allowed. */
+    MicroBench(const MicroBench &);
+    MicroBench &operator=(const MicroBench &);
+
+public:
+    /**
+     * Main driver method.
+     * <br />
+     * <br />Times an operation.
+     *
+     * @param op The operation: a callable taking no arguments
+     *           and returning the number of units of work done
+     *           (<code>unsigned long long</code>, at least 1).
+     *
+     * @return The timings (per unit of work).
+     */
+    template<typename Op>
+    MicroStats run(Op);
+
+    /**
+     * Getter for <code>warmup</code>.
+     *
+     * @return The number of untimed warm-up repetitions.
+     */
+    unsigned int getWarmup() const;
+
+    /**
+     * Getter for <code>reps</code>.
+     *
+     * @return The number of timed repetitions.
+     */
+    unsigned int getReps() const;
+
+    /**
+     * Constructor.
+     *
+     * @param __warmup The number of untimed warm-up repetitions.
+     * @param __reps   The number of timed repetitions (at least 1).
+     * @param __minRep The shortest a timed repetition may take
+     *                 (in seconds).
+     */
+    explicit MicroBench(const unsigned int = MICRO_WARMUP,
+                        const unsigned int = MICRO_REPS,
+                        const double = MICRO_MIN_REP_SECONDS);
+};
+
+/**
+ * Writes the results of a benchmark run as a JSON document
+ * (one object: the run label and setup, and the array of results),
+ * to be compared against the ones of another build.
+ *
+ * @param out     The output stream.
+ * @param label   The run label (e.g. the commit measured).
+ * @param bench   The harness the results were taken with.
+ * @param results The results.
+ */
+void writeJson(std::ostream &,
+               const std::string &,
+               const MicroBench &,
+               const std::vector<MicroResult> &);
+
+// Main driver method run(...).
+template<typename Op>
+MicroStats MicroBench::run(Op op) {
+    unsigned long long k;
+    unsigned long long batch;
+    unsigned long long units;
+
+    unsigned int r;
+
+    std::chrono::duration<double> t;
+
+    for (batch = 1; ; batch *= 2) {
+        std::chrono::steady_clock::time_point t0
+            = std::chrono::steady_clock::now();
+
+        for (k = 0; k < batch; k++) {
+            op();
+        }
+
+        t = std::chrono::steady_clock::now() - t0;
+
+        if (t.count() >= minRep) {
+            break;
+        }
+    }
+
+    for (r = 0; r < warmup; r++) {
+        for (k = 0; k < batch; k++) {
+            op();
+        }
+    }
+
+    samples.clear();
+
+    for (r = 0; r < reps; r++) {
+        units = 0;
+
+        std::chrono::steady_clock::time_point t0
+            = std::chrono::steady_clock::now();
+
+        for (k = 0; k < batch; k++) {
+            units += op();
+        }
+
+        t = std::chrono::steady_clock::now() - t0;
+
+        samples.push_back(t.count() * NS_PER_SECOND / units);
+    }
+
+    return summarize(batch);
+}
+
+} // namespace NLPUCCLIHooke
+
+#endif // __CC__MICROBENCH_H
+
+// vim:set nu et ts=4 sw=4:
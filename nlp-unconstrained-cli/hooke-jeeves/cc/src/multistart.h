@@ -0,0 +1,181 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/multistart.h
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#ifndef __CC__MULTISTART_H
+#define __CC__MULTISTART_H
+
+#include "solverset.h"
+#include "threadpool.h"
+
+/**
+ * The <code>NLPUCCLIHooke</code> namespace is used as a container
+ * for the <code>MultiStart</code> class.
+ */
+namespace NLPUCCLIHooke {
+
+/** Constant. The seed for generating the multi-start points. */
+const unsigned int MULTISTART_SEED = 566;
+
+/**
+ * Constant. The half-width of the box around the default starting guess
+ * the multi-start points are drawn from.
+ */
+const double MULTISTART_SPREAD = 2.0;
+
+/**
+ * The <code>MultiStart</code> class template is a driver that runs
+ * the Hooke and Jeeves algorithm from many starting points at once,
+ * spreading them across a work-stealing thread pool.
+ * <br />
+ * <br />Every worker owns its solver instances (see <code>SolverSet</code>),
+ * so nothing is shared between the solves, and the solves after
+ * the first one on a worker allocate nothing.
+ *
+ * @param Objective The class providing the objective function.
+ * @param N         The number of variables, or <code>DYNAMIC_VARS</code>.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @see     Hooke
+ * @see     SolverSet
+ * @see     ThreadPool
+ * @since   hooke-jeeves 0.1
+ */
+template<typename Objective, unsigned int N = DYNAMIC_VARS>
+class MultiStart {
+private:
+    /** The thread pool to run the solves on. */
+    ThreadPool &pool;
+
+    /** The per-worker solver instances. */
+    SolverSet<Objective, N> solvers;
+
+public:
+    /**
+     * Main driver method.
+     * <br />
+     * <br />Solves the problem from each of the starting points
+     * and picks the best ending point.
+     *
+     * @param nVars    The number of variables.
+     * @param nStarts  The number of starting points.
+     * @param startPts The starting points coordinates
+     *                 (<code>nStarts</code> rows of <code>nVars</code>).
+     * @param endPts   The ending points coordinates (the same layout).
+     * @param rho      The rho value.
+     * @param epsilon  The epsilon value.
+     * @param iterMax  The maximum number of iterations.
+     * @param iters    The number of iterations per start (output).
+     * @param evals    The number of function evaluations per start
+     *                 (output).
+     * @param fEnd     The objective function value at each ending point
+     *                 (output).
+     *
+     * @return The index of the start that reached the lowest value.
+     */
+    unsigned int multiStart(const unsigned int,
+                            const unsigned int,
+                            const double *,
+                            double *,
+                            const double,
+                            const double,
+                            const unsigned int,
+                            unsigned int *,
+                            unsigned int *,
+                            double *);
+
+    /**
+     * Setter for the exploratory move strategy of every solve.
+     * <br />
+     * <br />The poll points are evaluated in the worker running the solve:
+     * the parallelism here comes from the starting points.
+     *
+     * @param __poll The exploratory move strategy.
+     */
+    void setPoll(const PollMode);
+
+    /**
+     * Constructor.
+     *
+     * @param __pool      The thread pool to run the solves on.
+     * @param __objective The objective function provider.
+     */
+    explicit MultiStart(ThreadPool &, const Objective & = Objective());
+};
+
+// Main driver method multiStart(...).
+template<typename Objective, unsigned int N>
+unsigned int MultiStart<Objective, N>::multiStart(const unsigned int nVars,
+                                                  const unsigned int nStarts,
+                                                  const double *startPts,
+                                                  double *endPts,
+                                                  const double rho,
+                                                  const double epsilon,
+                                                  const unsigned int iterMax,
+                                                  unsigned int *iters,
+                                                  unsigned int *evals,
+                                                  double *fEnd) {
+
+    unsigned int k;
+    unsigned int best;
+
+    solvers.fit(nVars);
+
+    for (k = 0; k < nStarts; k++) {
+        pool.submit([=](const unsigned int w) {
+            iters[k] = solvers.solve(w, nVars, startPts + k * nVars,
+                                     endPts + k * nVars, rho, epsilon,
+                                     iterMax, &evals[k], &fEnd[k]);
+        });
+    }
+
+    pool.wait();
+
+    best = 0;
+
+    for (k = 1; k < nStarts; k++) {
+        if (fEnd[k] < fEnd[best]) {
+            best = k;
+        }
+    }
+
+    return best;
+}
+
+// Setter for the exploratory move strategy of every solve.
+template<typename Objective, unsigned int N>
+void MultiStart<Objective, N>::setPoll(const PollMode __poll) {
+    solvers.setPoll(__poll);
+}
+
+// Constructor.
+template<typename Objective, unsigned int N>
+MultiStart<Objective, N>::MultiStart(ThreadPool &__pool,
+                                     const Objective &__objective)
+    : pool(__pool), solvers(__pool.size(), __objective) {}
+
+} // namespace NLPUCCLIHooke
+
+#endif // __CC__MULTISTART_H
+
+// vim:set nu et ts=4 sw=4:
@@ -0,0 +1,336 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/objective.h
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#ifndef __CC__OBJECTIVE_H
+#define __CC__OBJECTIVE_H
+
+#include <cstddef>
+
+/*
+ * The SIMD kernels of the objective functions (AVX2 and AVX-512, picked
+ * at run time) are x86-only; anywhere else the scalar kernels are used.
+ */
+#if defined(__x86_64__) || defined(__i386__)
+    #define OBJECTIVE_X86_KERNELS
+#endif
+
+/**
+ * The <code>NLPUCCLIHooke</code> namespace is used as a container
+ * for the objective function interface helpers.
+ * <br />
+ * <br />An objective function provider (a template argument
+ * of <code>Hooke</code>) has to supply
+ * <pre>
+ *   double f(const double *x, const unsigned int n, FunEvals *funEvals);
+ * </pre>
+ * and may additionally supply the optional interfaces below,
+ * which are detected at compile time.
+ * <ul><li>Incremental evaluation after a change of one coordinate:
+ * <pre>
+ *   double fDelta(const double *x, const unsigned int n, const double fPrev,
+ *                 const unsigned int i, const double xOld, const double xNew,
+ *                 FunEvals *funEvals);
+ * </pre></li>
+ *     <li>Partial evaluation, abandoned as soon as the value is known
+ *         to reach the threshold (for sums of nonnegative terms):
+ * <pre>
+ *   double fBounded(const double *x, const unsigned int n,
+ *                   const double threshold, bool *rejected,
+ *                   FunEvals *funEvals);
+ * </pre></li>
+ *     <li>Batch evaluation of m points laid out as structure-of-arrays
+ *         (coordinate i of point k at <code>x[i * m + k]</code>):
+ * <pre>
+ *   void fBatch(const double *x, const unsigned int n, const unsigned int m,
+ *               double *f, FunEvals *funEvals);
+ * </pre></li></ul>
+ */
+namespace NLPUCCLIHooke {
+
+/**
+ * The <code>HasFDelta</code> class template tells whether an objective
+ * function provider supplies the incremental <code>fDelta()</code>.
+ *
+ * @param Objective The objective function provider.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @see     Hooke
+ * @since   hooke-jeeves 0.1
+ */
+template<typename Objective>
+class HasFDelta {
+private:
+    template<typename T>
+    static char test(decltype(&T::fDelta));
+
+    template<typename T>
+    static long test(...);
+
+public:
+    /** Constant. Whether <code>fDelta()</code> is there. */
+    static const bool value = (sizeof(test<Objective>(0)) == sizeof(char));
+};
+
+/**
+ * The <code>Incremental</code> class template evaluates the objective
+ * function after a change of one coordinate: through <code>fDelta()</code>
+ * if the provider supplies it, otherwise from scratch.
+ *
+ * @param Objective The objective function provider.
+ * @param Supported Whether the provider supplies <code>fDelta()</code>.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @see     HasFDelta
+ * @since   hooke-jeeves 0.1
+ */
+template<typename Objective, bool Supported = HasFDelta<Objective>::value>
+class Incremental {
+public:
+    /**
+     * Evaluates f(x) after <code>x[i]</code> has changed
+     * from <code>xOld</code> to <code>xNew</code>.
+     *
+     * @param objective The objective function provider.
+     * @param x         The point after the change.
+     * @param n         The number of coordinates of <code>x</code>.
+     * @param fPrev     The objective function value before the change.
+     * @param i         The index of the changed coordinate.
+     * @param xOld      The old value of <code>x[i]</code>.
+     * @param xNew      The new value of <code>x[i]</code>.
+     * @param funEvals  The number of function evaluations counter.
+     *
+     * @return The objective function value after the change.
+     */
+    static double f(Objective &objective,
+                    const double *x,
+                    const unsigned int n,
+                    const double fPrev,
+                    const unsigned int i,
+                    const double xOld,
+                    const double xNew,
+                    FunEvals *funEvals) {
+
+        return objective.f(x, n, funEvals);
+    }
+};
+
+// The specialization for the providers supplying fDelta().
+template<typename Objective>
+class Incremental<Objective, true> {
+public:
+    // Evaluates f(x) after x[i] has changed from xOld to xNew.
+    static double f(Objective &objective,
+                    const double *x,
+                    const unsigned int n,
+                    const double fPrev,
+                    const unsigned int i,
+                    const double xOld,
+                    const double xNew,
+                    FunEvals *funEvals) {
+
+        return objective.fDelta(x, n, fPrev, i, xOld, xNew, funEvals);
+    }
+};
+
+/**
+ * The <code>HasFBounded</code> class template tells whether an objective
+ * function provider supplies the early-abort <code>fBounded()</code>.
+ *
+ * @param Objective The objective function provider.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @see     Hooke
+ * @since   hooke-jeeves 0.1
+ */
+template<typename Objective>
+class HasFBounded {
+private:
+    template<typename T>
+    static char test(decltype(&T::fBounded));
+
+    template<typename T>
+    static long test(...);
+
+public:
+    /** Constant. Whether <code>fBounded()</code> is there. */
+    static const bool value = (sizeof(test<Objective>(0)) == sizeof(char));
+};
+
+/**
+ * The <code>Bounded</code> class template evaluates the objective
+ * function against an abort threshold: through <code>fBounded()</code>
+ * if the provider supplies it, otherwise in full (never rejecting).
+ *
+ * @param Objective The objective function provider.
+ * @param Supported Whether the provider supplies <code>fBounded()</code>.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @see     HasFBounded
+ * @since   hooke-jeeves 0.1
+ */
+template<typename Objective, bool Supported = HasFBounded<Objective>::value>
+class Bounded {
+public:
+    /**
+     * Evaluates f(x), possibly stopping as soon as it is known
+     * that f(x) &gt;= <code>threshold</code>.
+     *
+     * @param objective The objective function provider.
+     * @param x         The point at which f(x) should be evaluated.
+     * @param n         The number of coordinates of <code>x</code>.
+     * @param threshold The abort threshold.
+     * @param rejected  Whether the evaluation has been abandoned (output).
+     * @param funEvals  The number of function evaluations counter.
+     *
+     * @return The objective function value, or a partial value
+     *         not less than <code>threshold</code> if rejected.
+     */
+    static double f(Objective &objective,
+                    const double *x,
+                    const unsigned int n,
+                    const double threshold,
+                    bool *rejected,
+                    FunEvals *funEvals) {
+
+        *rejected = false;
+
+        return objective.f(x, n, funEvals);
+    }
+};
+
+// The specialization for the providers supplying fBounded().
+template<typename Objective>
+class Bounded<Objective, true> {
+public:
+    // Evaluates f(x), possibly stopping once f(x) >= threshold is known.
+    static double f(Objective &objective,
+                    const double *x,
+                    const unsigned int n,
+                    const double threshold,
+                    bool *rejected,
+                    FunEvals *funEvals) {
+
+        return objective.fBounded(x, n, threshold, rejected, funEvals);
+    }
+};
+
+/**
+ * The <code>HasFBatch</code> class template tells whether an objective
+ * function provider supplies the batch <code>fBatch()</code>.
+ *
+ * @param Objective The objective function provider.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @see     Hooke
+ * @since   hooke-jeeves 0.1
+ */
+template<typename Objective>
+class HasFBatch {
+private:
+    template<typename T>
+    static char test(decltype(&T::fBatch));
+
+    template<typename T>
+    static long test(...);
+
+public:
+    /** Constant. Whether <code>fBatch()</code> is there. */
+    static const bool value = (sizeof(test<Objective>(0)) == sizeof(char));
+};
+
+/**
+ * The <code>Batched</code> class template evaluates the objective
+ * function at a batch of points: through <code>fBatch()</code>
+ * if the provider supplies it, otherwise point by point.
+ *
+ * @param Objective The objective function provider.
+ * @param Supported Whether the provider supplies <code>fBatch()</code>.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @see     HasFBatch
+ * @since   hooke-jeeves 0.1
+ */
+template<typename Objective, bool Supported = HasFBatch<Objective>::value>
+class Batched {
+public:
+    /**
+     * Evaluates f(x) at m points.
+     *
+     * @param objective The objective function provider.
+     * @param x         The points, as structure-of-arrays
+     *                  (coordinate i of point k at <code>x[i * m + k]</code>).
+     * @param n         The number of coordinates of a point.
+     * @param m         The number of points.
+     * @param f         The objective function values (output, m).
+     * @param scratch   The room for one point (n), to gather it into.
+     * @param funEvals  The number of function evaluations counter.
+     */
+    static void f(Objective &objective,
+                  const double *x,
+                  const unsigned int n,
+                  const unsigned int m,
+                  double *f,
+                  double *scratch,
+                  FunEvals *funEvals) {
+
+        unsigned int i;
+        unsigned int k;
+
+        for (k = 0; k < m; k++) {
+            for (i = 0; i < n; i++) {
+                scratch[i] = x[(std::size_t) i * m + k];
+            }
+
+            f[k] = objective.f(scratch, n, funEvals);
+        }
+    }
+};
+
+// The specialization for the providers supplying fBatch().
+template<typename Objective>
+class Batched<Objective, true> {
+public:
+    // Evaluates f(x) at m points.
+    static void f(Objective &objective,
+                  const double *x,
+                  const unsigned int n,
+                  const unsigned int m,
+                  double *f,
+                  double *scratch,
+                  FunEvals *funEvals) {
+
+        objective.fBatch(x, n, m, f, funEvals);
+    }
+};
+
+} // namespace NLPUCCLIHooke
+
+#endif // __CC__OBJECTIVE_H
+
+// vim:set nu et ts=4 sw=4:
@@ -0,0 +1,223 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/problem.h
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#ifndef __CC__PROBLEM_H
+#define __CC__PROBLEM_H
+
+#include <limits>
+
+#include "hooke.h"
+#include "asynctrace.h"
+
+/**
+ * The <code>NLPUCCLIHooke</code> namespace is used as a container
+ * for the <code>Options</code> and <code>Problem</code> structures.
+ */
+namespace NLPUCCLIHooke {
+
+/** Constant. The number of timed solves per problem of a benchmark. */
+const unsigned int BENCH_REPS = 5;
+
+/** Constant. The width of the problem name column of a benchmark. */
+const unsigned int BENCH_NAME_WIDTH = 12;
+
+/** Constant. The header line of the benchmark table. */
+const char BENCH_HEADER[]
+    = "problem        n    iters   funevals      seconds           f(x)";
+
+/** Constant. The most variables of a problem that takes any number. */
+const unsigned int UNBOUNDED_VARS = std::numeric_limits<unsigned int>::max();
+
+struct Problem;
+class  Solvers;
+
+/** The command-line options (the solver setup shared by the problems). */
+struct Options {
+    /** The program name (for the error messages). */
+    const char *prog;
+
+    /** The maximum number of iterations. */
+    unsigned int iterMax;
+
+    /** The epsilon value. */
+    double epsilon;
+
+    /** The number of starting points of the multi-start mode. */
+    unsigned int nStarts;
+
+    /** The number of threads (0 means one per hardware thread). */
+    unsigned int nThreads;
+
+    /** The number of the evaluation cache entries (0 means no cache). */
+    unsigned int nCache;
+
+    /** The number of SIMD lanes of the multi-start mode (0: the pool). */
+    unsigned int nLanes;
+
+    /** The exploratory move strategy. */
+    PollMode poll;
+
+    /** Whether to use the incremental objective function. */
+    bool incr;
+
+    /** Whether to use the early-abort objective function. */
+    bool abort;
+
+    /** The amount of the progress to report. */
+    TraceLevel level;
+
+    /** The iteration step of <code>TRACE_EVERY</code>. */
+    unsigned int every;
+
+    /** The layout of the trace records. */
+    TraceFormat format;
+
+    /** The trace file path, or <code>NULL</code> for the standard output. */
+    const char *traceTo;
+
+    /** Whether the trace records get written by a thread of their own. */
+    bool async;
+
+    /** What to do with the records of a full asynchronous trace. */
+    TracePolicy policy;
+
+    /** The batch start-point file path, or <code>NULL</code>. */
+    const char *batchIn;
+
+    /** The batch result file path. */
+    const char *batchOut;
+
+    /** The batch result layout, or <code>NULL</code> for the input one. */
+    const char *batchFmt;
+
+    /** The number of timed solves of the benchmark mode (0: no bench). */
+    unsigned int nReps;
+
+    /**
+     * The command of the evaluation workers, or <code>NULL</code>
+     * to evaluate in process (see <code>evalpool.h</code>).
+     */
+    const char *remote;
+
+    /** The number of the evaluation workers. */
+    unsigned int nRemote;
+
+    /** The problem registry (the problems a batch row may name). */
+    const Problem *problems;
+
+    /** The number of the registered problems. */
+    unsigned int nProblems;
+};
+
+/** A registered problem: an objective function and its test setup. */
+struct Problem {
+    /** The name the problem is selected by. */
+    const char *name;
+
+    /** The number of variables. */
+    unsigned int nVars;
+
+    /** The fewest variables the objective function takes. */
+    unsigned int minVars;
+
+    /**
+     * The most variables the objective function takes
+     * (<code>UNBOUNDED_VARS</code> if there is no limit).
+     */
+    unsigned int maxVars;
+
+    /** The standard starting guess. */
+    const double *startPt;
+
+    /** The rho value. */
+    double rho;
+
+    /** The line telling the true answer, or <code>NULL</code>. */
+    const char *answer;
+
+    /**
+     * The runner: the solver modes instantiated for the objective
+     * function (see <code>runProblem()</code>).
+     *
+     * @param problem The problem.
+     * @param opts    The command-line options.
+     *
+     * @return The exit status.
+     */
+    int (*run)(const Problem &, const Options &);
+
+    /**
+     * The per-worker solvers of the batch mode, instantiated
+     * for the objective function (see <code>newSolvers()</code>).
+     *
+     * @param workers The number of workers.
+     * @param nVars   The number of variables.
+     *
+     * @return The solvers (to be deleted by the caller).
+     */
+    Solvers *(*solvers)(const unsigned int, const unsigned int);
+};
+
+/**
+ * Solves a problem in the mode the options ask for: the benchmark one,
+ * the batch one, the multi-start one, or a single solve
+ * from the standard starting guess.
+ * <br />
+ * <br />Everything down from here is instantiated for the objective
+ * function, so it gets called directly from the solver loops: a problem
+ * is resolved once per run, not once per evaluation. Each objective
+ * function has its instantiation compiled in a translation unit
+ * of its own (see <code>runrosenbrock.cc</code>), so the solver code
+ * gets optimized for it exactly as when it was the only one.
+ *
+ * @param Objective The class providing the objective function.
+ * @param N         The number of variables, or <code>DYNAMIC_VARS</code>.
+ *
+ * @param problem The problem.
+ * @param opts    The command-line options.
+ *
+ * @return The exit status.
+ */
+template<typename Objective, unsigned int N>
+int runProblem(const Problem &, const Options &);
+
+/**
+ * Makes the per-worker solvers of the batch mode for an objective
+ * function: the fixed-size ones if the rows are of its own dimension.
+ *
+ * @param Objective The class providing the objective function.
+ * @param N         The number of variables, or <code>DYNAMIC_VARS</code>.
+ *
+ * @param workers The number of workers.
+ * @param nVars   The number of variables.
+ *
+ * @return The solvers (to be deleted by the caller).
+ */
+template<typename Objective, unsigned int N>
+Solvers *newSolvers(const unsigned int, const unsigned int);
+
+} // namespace NLPUCCLIHooke
+
+#endif // __CC__PROBLEM_H
+
+// vim:set nu et ts=4 sw=4:
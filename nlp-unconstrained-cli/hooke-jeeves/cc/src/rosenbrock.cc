@@ -22,32 +22,279 @@
  */
 
 #include "rosenbrock.h"
-#include "funevals.h"
+
+#ifdef OBJECTIVE_X86_KERNELS
+    #include <immintrin.h>
+#endif
 
 // The NLPUCCLIHooke namespace.
 namespace NLPUCCLIHooke {
 
-// Helper constant.
-const double ONE_HUNDRED_POINT_ZERO = 100.0;
+#ifdef OBJECTIVE_X86_KERNELS
+// Helper constants (the number of points per AVX2 and AVX-512 vector).
+const unsigned int AVX2_POINTS   = 4;
+const unsigned int AVX512_POINTS = 8;
+#endif
+
+// The batch kernel: scalar.
+void Rosenbrock::batchScalar(const double *x,
+                             const unsigned int n,
+                             const unsigned int m,
+                             const unsigned int k,
+                             double *f) {
+
+    double s;
+
+    unsigned int i;
+    unsigned int p;
+
+    for (p = k; p < m; p++) {
+        s = 0.0;
+
+        for (i = 0; i + 1 < n; i++) {
+            s += term(x[(std::size_t) i * m + p],
+                      x[(std::size_t) (i + 1) * m + p]);
+        }
+
+        f[p] = s;
+    }
+}
+
+#ifdef OBJECTIVE_X86_KERNELS
+// The batch kernel: AVX2, the same operations as term() does.
+__attribute__((target("avx2")))
+void Rosenbrock::batchAvx2(const double *x,
+                           const unsigned int n,
+                           const unsigned int m,
+                           const unsigned int k,
+                           double *f) {
+
+    const __m256d hundred = _mm256_set1_pd(ONE_HUNDRED_POINT_ZERO);
+    const __m256d one     = _mm256_set1_pd(ONE_POINT_ZERO);
+
+    __m256d s;
+    __m256d a;
+    __m256d b;
+    __m256d d;
+    __m256d e;
+
+    unsigned int i;
+    unsigned int p;
+
+    for (p = k; p + AVX2_POINTS <= m; p += AVX2_POINTS) {
+        s = _mm256_setzero_pd();
+
+        for (i = 0; i + 1 < n; i++) {
+            a = _mm256_loadu_pd(x + (std::size_t) i * m + p);
+            b = _mm256_loadu_pd(x + (std::size_t) (i + 1) * m + p);
+
+            d = _mm256_sub_pd(b, _mm256_mul_pd(a, a));
+            e = _mm256_sub_pd(one, a);
+
+            s = _mm256_add_pd(s,
+                _mm256_add_pd(_mm256_mul_pd(_mm256_mul_pd(hundred, d), d),
+                              _mm256_mul_pd(e, e)));
+        }
+
+        _mm256_storeu_pd(f + p, s);
+    }
+
+    batchScalar(x, n, m, p, f);
+}
+
+// The batch kernel: AVX-512, the same operations as term() does.
+__attribute__((target("avx512f")))
+void Rosenbrock::batchAvx512(const double *x,
+                             const unsigned int n,
+                             const unsigned int m,
+                             const unsigned int k,
+                             double *f) {
+
+    const __m512d hundred = _mm512_set1_pd(ONE_HUNDRED_POINT_ZERO);
+    const __m512d one     = _mm512_set1_pd(ONE_POINT_ZERO);
+
+    __m512d s;
+    __m512d a;
+    __m512d b;
+    __m512d d;
+    __m512d e;
+
+    unsigned int i;
+    unsigned int p;
+
+    for (p = k; p + AVX512_POINTS <= m; p += AVX512_POINTS) {
+        s = _mm512_setzero_pd();
+
+        for (i = 0; i + 1 < n; i++) {
+            a = _mm512_loadu_pd(x + (std::size_t) i * m + p);
+            b = _mm512_loadu_pd(x + (std::size_t) (i + 1) * m + p);
+
+            d = _mm512_sub_pd(b, _mm512_mul_pd(a, a));
+            e = _mm512_sub_pd(one, a);
+
+            s = _mm512_add_pd(s,
+                _mm512_add_pd(_mm512_mul_pd(_mm512_mul_pd(hundred, d), d),
+                              _mm512_mul_pd(e, e)));
+        }
+
+        _mm512_storeu_pd(f + p, s);
+    }
+
+    batchAvx2(x, n, m, p, f);
+}
+#endif
+
+// The batch objective function.
+void Rosenbrock::fBatch(const double *x,
+                        const unsigned int n,
+                        const unsigned int m,
+                        double *f,
+                        FunEvals *funEvals) {
+
+    typedef void (*Kernel)(const double *,
+                           const unsigned int,
+                           const unsigned int,
+                           const unsigned int,
+                           double *);
 
-// The user-supplied objective function f(x,n).
-double Rosenbrock::f(const double *x,
-                     const unsigned int n,
-                     const void *cFunEvals) {
+    // Picking the kernel once, on the first call.
+#ifdef OBJECTIVE_X86_KERNELS
+    static const Kernel kernel
+        = __builtin_cpu_supports("avx512f") ? &batchAvx512
+        : __builtin_cpu_supports("avx2")    ? &batchAvx2
+        :                                     &batchScalar;
+#else
+    static const Kernel kernel = &batchScalar;
+#endif
+
+    funEvals->add(FUN_EVALS, m);
+
+    kernel(x, n, m, 0, f);
+}
+
+// The single-point kernel: scalar.
+double Rosenbrock::sumScalar(const double *x,
+                             const unsigned int n,
+                             const unsigned int k,
+                             const double s) {
+
+    double sum = s;
+
+    unsigned int i;
+
+    for (i = k; i + 1 < n; i++) {
+        sum += term(x[i], x[i + 1]);
+    }
+
+    return sum;
+}
+
+#ifdef OBJECTIVE_X86_KERNELS
+// The single-point kernel: AVX2, the same operations as term() does.
+__attribute__((target("avx2")))
+double Rosenbrock::sumAvx2(const double *x,
+                           const unsigned int n,
+                           const unsigned int k,
+                           const double s) {
+
+    const __m256d hundred = _mm256_set1_pd(ONE_HUNDRED_POINT_ZERO);
+    const __m256d one     = _mm256_set1_pd(ONE_POINT_ZERO);
+
+    __m256d a;
+    __m256d b;
+    __m256d d;
+    __m256d e;
+
+    double sum = s;
+    double t[AVX2_POINTS];
+
+    unsigned int i;
+    unsigned int j;
+
+    // Four terms at a time: x[i + 4] is the last coordinate read.
+    for (i = k; i + AVX2_POINTS < n; i += AVX2_POINTS) {
+        a = _mm256_loadu_pd(x + i);
+        b = _mm256_loadu_pd(x + i + 1);
+
+        d = _mm256_sub_pd(b, _mm256_mul_pd(a, a));
+        e = _mm256_sub_pd(one, a);
+
+        _mm256_storeu_pd(t,
+            _mm256_add_pd(_mm256_mul_pd(_mm256_mul_pd(hundred, d), d),
+                          _mm256_mul_pd(e, e)));
+
+        for (j = 0; j < AVX2_POINTS; j++) {
+            sum += t[j];
+        }
+    }
+
+    return sumScalar(x, n, i, sum);
+}
+
+// The single-point kernel: AVX-512, the same operations as term() does.
+__attribute__((target("avx512f")))
+double Rosenbrock::sumAvx512(const double *x,
+                             const unsigned int n,
+                             const unsigned int k,
+                             const double s) {
+
+    const __m512d hundred = _mm512_set1_pd(ONE_HUNDRED_POINT_ZERO);
+    const __m512d one     = _mm512_set1_pd(ONE_POINT_ZERO);
+
+    __m512d a;
+    __m512d b;
+    __m512d d;
+    __m512d e;
+
+    double sum = s;
+    double t[AVX512_POINTS];
+
+    unsigned int i;
+    unsigned int j;
+
+    for (i = k; i + AVX512_POINTS < n; i += AVX512_POINTS) {
+        a = _mm512_loadu_pd(x + i);
+        b = _mm512_loadu_pd(x + i + 1);
+
+        d = _mm512_sub_pd(b, _mm512_mul_pd(a, a));
+        e = _mm512_sub_pd(one, a);
+
+        _mm512_storeu_pd(t,
+            _mm512_add_pd(_mm512_mul_pd(_mm512_mul_pd(hundred, d), d),
+                          _mm512_mul_pd(e, e)));
+
+        for (j = 0; j < AVX512_POINTS; j++) {
+            sum += t[j];
+        }
+    }
+
+    return sumAvx2(x, n, i, sum);
+}
+#endif
 
-    double a;
-    double b;
-    double c;
+// The vector objective function.
+double Rosenbrock::fVector(const double *x,
+                           const unsigned int n,
+                           FunEvals *funEvals) {
 
-    ((FunEvals *) cFunEvals)->setFunEvals(
-    ((FunEvals *) cFunEvals)->getFunEvals() + 1);
+    typedef double (*Kernel)(const double *,
+                             const unsigned int,
+                             const unsigned int,
+                             const double);
 
-    a = x[INDEX_ZERO];
-    b = x[INDEX_ONE];
+    // Picking the kernel once, on the first call.
+#ifdef OBJECTIVE_X86_KERNELS
+    static const Kernel kernel
+        = __builtin_cpu_supports("avx512f") ? &sumAvx512
+        : __builtin_cpu_supports("avx2")    ? &sumAvx2
+        :                                     &sumScalar;
+#else
+    static const Kernel kernel = &sumScalar;
+#endif
 
-    c = ONE_HUNDRED_POINT_ZERO * (b - (a * a)) * (b - (a * a));
+    funEvals->add(FUN_EVALS);
 
-    return (c + ((ONE_POINT_ZERO - a) * (ONE_POINT_ZERO - a)));
+    return kernel(x, n, 0, 0.0);
 }
 
 // Default constructor.
@@ -33,14 +33,15 @@
 namespace NLPUCCLIHooke {
 
 /** Helper constant. */
-extern const double ONE_HUNDRED_POINT_ZERO;
+const double ONE_HUNDRED_POINT_ZERO = 100.0;
 
 /**
  * The <code>Rosenbrock</code> class is responsible for solving a nonlinear
  * optimization problem using the algorithm of Hooke and Jeeves.
  * <br />
  * <br />The objective function in this case
- * is the Rosenbrock's parabolic valley function.
+ * is the Rosenbrock's parabolic valley function, extended (chained)
+ * to n variables; for n = 2 it is exactly the classic one.
  *
  * @author  Radislav (Radicchio) Golubtsov
  * @version 0.1.1
@@ -48,21 +49,209 @@ extern const double ONE_HUNDRED_POINT_ZERO;
  * @since   hooke-jeeves 0.1
  */
 class Rosenbrock {
+private:
+    /**
+     * Helper method.
+     * <br />
+     * <br />One term of the chained sum: the classic function
+     * of two consecutive coordinates.
+     *
+     * @param a The first coordinate.
+     * @param b The second coordinate.
+     *
+     * @return The value of the term.
+     */
+    static double term(const double, const double);
+
+    /**
+     * Helper methods.
+     * <br />
+     * <br />The batch kernels (see <code>fBatch()</code>): each of them
+     * evaluates the points from <code>k</code> on.
+     *
+     * @param x The points (coordinate i of point k at x[i * m + k]).
+     * @param n The number of coordinates of a point.
+     * @param m The number of points.
+     * @param k The first point to evaluate.
+     * @param f The objective function values (output, m).
+     */
+    static void batchScalar(const double *,
+                            const unsigned int,
+                            const unsigned int,
+                            const unsigned int,
+                            double *);
+
+#ifdef OBJECTIVE_X86_KERNELS
+    static void batchAvx2(const double *,
+                          const unsigned int,
+                          const unsigned int,
+                          const unsigned int,
+                          double *);
+
+    static void batchAvx512(const double *,
+                            const unsigned int,
+                            const unsigned int,
+                            const unsigned int,
+                            double *);
+#endif
+
+    /**
+     * Helper methods.
+     * <br />
+     * <br />The single-point kernels (see <code>fVector()</code>): each
+     * of them adds the terms from the one at <code>k</code> on
+     * to the sum, in order.
+     *
+     * @param x The point.
+     * @param n The number of coordinates of <code>x</code>.
+     * @param k The first coordinate of the first term to add.
+     * @param s The sum of the terms before it.
+     *
+     * @return The sum of all the terms.
+     */
+    static double sumScalar(const double *,
+                            const unsigned int,
+                            const unsigned int,
+                            const double);
+
+#ifdef OBJECTIVE_X86_KERNELS
+    static double sumAvx2(const double *,
+                          const unsigned int,
+                          const unsigned int,
+                          const double);
+
+    static double sumAvx512(const double *,
+                            const unsigned int,
+                            const unsigned int,
+                            const double);
+#endif
+
 public:
+    /** Constant. The number of variables of the test problem. */
+    static const unsigned int NVARS = 2;
+
     /**
      * The user-supplied objective function f(x,n).
      * <br />
      * <br />Represents here the Rosenbrock's classic parabolic valley
-     * (&quot;banana&quot;) function.
+     * (&quot;banana&quot;) function, chained over all the n - 1 pairs
+     * of consecutive coordinates.
+     * <br />
+     * <br />Every point goes to <code>fScalar()</code>: the vector kernel
+     * is no faster at any number of variables (see
+     * <code>fVector()</code>).
      *
      * @param x         The point at which f(x) should be evaluated.
      * @param n         The number of coordinates of <code>x</code>.
-     * @param cFunEvals The number of function evaluations container
-     *                  (FunEvals *).
+     * @param funEvals  The number of function evaluations counter.
      *
      * @return The objective function value.
      */
-    static double f(const double *, const unsigned int, const void *);
+    static double f(const double *, const unsigned int, FunEvals *);
+
+    /**
+     * The scalar objective function: f(x,n), one term after another.
+     *
+     * @param x         The point at which f(x) should be evaluated.
+     * @param n         The number of coordinates of <code>x</code>.
+     * @param funEvals  The number of function evaluations counter.
+     *
+     * @return The objective function value.
+     */
+    static double fScalar(const double *, const unsigned int, FunEvals *);
+
+    /**
+     * The vector objective function: f(x,n), four (AVX2) or eight
+     * (AVX-512) terms at a time.
+     * <br />
+     * <br />The kernel is picked at runtime, once, as for
+     * <code>fBatch()</code>. The terms are computed with the same
+     * operations as <code>fScalar()</code> does, then added up one
+     * after another, in the same order, so the value is bit-for-bit
+     * the scalar one. A Rosenbrock term is too cheap for that to pay:
+     * the serial sum bounds both kernels, and the vector one loses
+     * the time it spends storing and reloading the terms, so it is
+     * not what <code>f()</code> uses (it is there for
+     * <code>hooke-dimsweep</code> to measure).
+     *
+     * @param x         The point at which f(x) should be evaluated.
+     * @param n         The number of coordinates of <code>x</code>.
+     * @param funEvals  The number of function evaluations counter.
+     *
+     * @return The objective function value.
+     */
+    static double fVector(const double *, const unsigned int, FunEvals *);
+
+    /**
+     * The incremental objective function.
+     * <br />
+     * <br />Updates f(x) after a change of the single coordinate
+     * <code>x[i]</code>, touching only the (at most two) terms
+     * it enters.
+     *
+     * @param x         The point after the change
+     *                  (<code>x[i] == xNew</code>).
+     * @param n         The number of coordinates of <code>x</code>.
+     * @param fPrev     The objective function value before the change.
+     * @param i         The index of the changed coordinate.
+     * @param xOld      The old value of <code>x[i]</code>.
+     * @param xNew      The new value of <code>x[i]</code>.
+     * @param funEvals  The number of function evaluations counter.
+     *
+     * @return The objective function value after the change.
+     */
+    static double fDelta(const double *,
+                         const unsigned int,
+                         const double,
+                         const unsigned int,
+                         const double,
+                         const double,
+                         FunEvals *);
+
+    /**
+     * The early-abort objective function.
+     * <br />
+     * <br />Sums the terms in the same order as <code>f()</code> does,
+     * but gives up as soon as the partial sum reaches the threshold:
+     * the terms are nonnegative, so the full sum cannot get below it.
+     *
+     * @param x         The point at which f(x) should be evaluated.
+     * @param n         The number of coordinates of <code>x</code>.
+     * @param threshold The abort threshold.
+     * @param rejected  Whether the evaluation has been abandoned (output).
+     * @param funEvals  The number of function evaluations counter.
+     *
+     * @return The objective function value, or the partial sum
+     *         if rejected.
+     */
+    static double fBounded(const double *,
+                           const unsigned int,
+                           const double,
+                           bool *,
+                           FunEvals *);
+
+    /**
+     * The batch objective function.
+     * <br />
+     * <br />Evaluates f(x) at m points laid out as structure-of-arrays,
+     * four (AVX2) or eight (AVX-512) points per vector.
+     * The kernel is picked at runtime, once: AVX-512, AVX2,
+     * or the scalar one, whichever the CPU supports. The values are
+     * bit-for-bit those of <code>f()</code> (the kernels do the same
+     * operations in the same order, with no fused multiply-adds).
+     *
+     * @param x         The points (coordinate i of point k
+     *                  at <code>x[i * m + k]</code>).
+     * @param n         The number of coordinates of a point.
+     * @param m         The number of points.
+     * @param f         The objective function values (output, m).
+     * @param funEvals  The number of function evaluations counter.
+     */
+    static void fBatch(const double *,
+                       const unsigned int,
+                       const unsigned int,
+                       double *,
+                       FunEvals *);
 
     /** Default constructor. */
     Rosenbrock();
@@ -71,6 +260,100 @@ public:
     ~Rosenbrock();
 };
 
+// Helper method term(...).
+inline double Rosenbrock::term(const double a, const double b) {
+    double c;
+
+    c = ONE_HUNDRED_POINT_ZERO * (b - (a * a)) * (b - (a * a));
+
+    return (c + ((ONE_POINT_ZERO - a) * (ONE_POINT_ZERO - a)));
+}
+
+/*
+ * The user-supplied objective function f(x,n).
+ * Defined inline, so that the engine could fold it into its exploratory loop.
+ */
+inline double Rosenbrock::f(const double *x,
+                            const unsigned int n,
+                            FunEvals *funEvals) {
+
+    return fScalar(x, n, funEvals);
+}
+
+// The scalar objective function.
+inline double Rosenbrock::fScalar(const double *x,
+                                  const unsigned int n,
+                                  FunEvals *funEvals) {
+
+    double s = 0.0;
+
+    unsigned int i;
+
+    funEvals->add(FUN_EVALS);
+
+    for (i = 0; i + 1 < n; i++) {
+        s += term(x[i], x[i + 1]);
+    }
+
+    return s;
+}
+
+// The incremental objective function.
+inline double Rosenbrock::fDelta(const double *x,
+                                 const unsigned int n,
+                                 const double fPrev,
+                                 const unsigned int i,
+                                 const double xOld,
+                                 const double xNew,
+                                 FunEvals *funEvals) {
+
+    double s = fPrev;
+
+    funEvals->add(FUN_EVALS);
+
+    // The term where x[i] is the second coordinate of the pair...
+    if (i > 0) {
+        s += term(x[i - 1], xNew) - term(x[i - 1], xOld);
+    }
+
+    // ...and the one where it is the first.
+    if (i + 1 < n) {
+        s += term(xNew, x[i + 1]) - term(xOld, x[i + 1]);
+    }
+
+    return s;
+}
+
+// The early-abort objective function.
+inline double Rosenbrock::fBounded(const double *x,
+                                   const unsigned int n,
+                                   const double threshold,
+                                   bool *rejected,
+                                   FunEvals *funEvals) {
+
+    double s = 0.0;
+
+    unsigned int i;
+
+    for (i = 0; i + 1 < n; i++) {
+        s += term(x[i], x[i + 1]);
+
+        if (s >= threshold) {
+            *rejected = true;
+
+            funEvals->add(REJECTED_EVALS);
+
+            return s;
+        }
+    }
+
+    *rejected = false;
+
+    funEvals->add(FUN_EVALS);
+
+    return s;
+}
+
 } // namespace NLPUCCLIHooke
 
 #endif // __CC__ROSENBROCK_H
@@ -0,0 +1,606 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/runner.h
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#ifndef __CC__RUNNER_H
+#define __CC__RUNNER_H
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "problem.h"
+#include "multistart.h"
+#include "batchsolve.h"
+#include "hookelanes.h"
+#include "bintrace.h"
+
+/**
+ * The <code>NLPUCCLIHooke</code> namespace is used as a container
+ * for the problem runners (see <code>runProblem()</code>).
+ */
+namespace NLPUCCLIHooke {
+
+/**
+ * Helper function.
+ * <br />
+ * <br />Solves all the starting points in <code>L</code> lanes
+ * (see <code>HookeLanes</code>) and picks the best ending point.
+ *
+ * @param nVars    The number of variables.
+ * @param nStarts  The number of starting points.
+ * @param startPts The starting points coordinates.
+ * @param endPts   The ending points coordinates (output).
+ * @param rho      The rho value.
+ * @param epsilon  The epsilon value.
+ * @param iterMax  The maximum number of iterations.
+ * @param iters    The number of iterations per start (output).
+ * @param evals    The number of function evaluations per start (output).
+ * @param fEnd     The objective function value at each ending point
+ *                 (output).
+ *
+ * @return The index of the start that reached the lowest value.
+ */
+template<typename Objective, unsigned int L>
+unsigned int solveLanes(const unsigned int nVars,
+                        const unsigned int nStarts,
+                        const double *startPts,
+                        double *endPts,
+                        const double rho,
+                        const double epsilon,
+                        const unsigned int iterMax,
+                        unsigned int *iters,
+                        unsigned int *evals,
+                        double *fEnd) {
+
+    unsigned int k;
+    unsigned int best = 0;
+
+    HookeLanes<Objective, L> hl;
+
+    FunEvals fe;
+
+    hl.hookeLanes(nVars, nStarts, startPts, endPts, rho, epsilon, iterMax,
+                  iters, evals, fEnd, &fe);
+
+    for (k = 1; k < nStarts; k++) {
+        if (fEnd[k] < fEnd[best]) {
+            best = k;
+        }
+    }
+
+    return best;
+}
+
+/**
+ * Helper function.
+ * <br />
+ * <br />Runs the multi-start mode: the default starting guess plus
+ * <code>nStarts - 1</code> points drawn uniformly from a box around it,
+ * all solved on a pool of <code>nThreads</code> threads, or else
+ * in <code>nLanes</code> SIMD lanes of one thread.
+ *
+ * @param nVars    The number of variables.
+ * @param startPt  The default starting point coordinates.
+ * @param rho      The rho value.
+ * @param epsilon  The epsilon value.
+ * @param iterMax  The maximum number of iterations.
+ * @param nStarts  The number of starting points.
+ * @param nThreads The number of threads (0 means one per hardware thread).
+ * @param poll     The exploratory move strategy of every solve.
+ * @param nLanes   The number of lanes (4, 8 or 16), or 0 for the pool.
+ */
+template<typename Objective, unsigned int N>
+void runMultiStart(const unsigned int nVars,
+                   const double *startPt,
+                   const double rho,
+                   const double epsilon,
+                   const unsigned int iterMax,
+                   const unsigned int nStarts,
+                   const unsigned int nThreads,
+                   const PollMode poll,
+                   const unsigned int nLanes) {
+
+    unsigned int i;
+    unsigned int k;
+    unsigned int best;
+
+    std::vector<double>       startPts(nStarts * nVars);
+    std::vector<double>       endPts(nStarts * nVars);
+    std::vector<unsigned int> iters(nStarts);
+    std::vector<unsigned int> evals(nStarts);
+    std::vector<double>       fEnd(nStarts);
+
+    std::mt19937 gen(MULTISTART_SEED);
+    std::uniform_real_distribution<double> spread(-MULTISTART_SPREAD,
+                                                   MULTISTART_SPREAD);
+
+    // The first start is the default starting guess itself.
+    for (i = 0; i < nVars; i++) {
+        startPts[i] = startPt[i];
+    }
+
+    for (k = 1; k < nStarts; k++) {
+        for (i = 0; i < nVars; i++) {
+            startPts[k * nVars + i] = startPt[i] + spread(gen);
+        }
+    }
+
+    if (nLanes == 0) {
+        ThreadPool pool(nThreads);
+
+        MultiStart<Objective, N> ms(pool);
+
+        ms.setPoll(poll);
+
+        best = ms.multiStart(nVars, nStarts, &startPts[0], &endPts[0], rho,
+                             epsilon, iterMax, &iters[0], &evals[0],
+                             &fEnd[0]);
+
+        std::cout << "\nMULTI-START: " << nStarts << " STARTS ON "
+                  << pool.size() << " THREADS\n";
+    } else {
+        if (nLanes == LANES_AVX2) {
+            best = solveLanes<Objective, LANES_AVX2>(
+                nVars, nStarts, &startPts[0], &endPts[0], rho, epsilon,
+                iterMax, &iters[0], &evals[0], &fEnd[0]);
+        } else if (nLanes == LANES_AVX512) {
+            best = solveLanes<Objective, LANES_AVX512>(
+                nVars, nStarts, &startPts[0], &endPts[0], rho, epsilon,
+                iterMax, &iters[0], &evals[0], &fEnd[0]);
+        } else {
+            best = solveLanes<Objective, LANES_WIDE>(
+                nVars, nStarts, &startPts[0], &endPts[0], rho, epsilon,
+                iterMax, &iters[0], &evals[0], &fEnd[0]);
+        }
+
+        std::cout << "\nMULTI-START: " << nStarts << " STARTS IN "
+                  << nLanes << " LANES\n";
+    }
+
+    for (k = 0; k < nStarts; k++) {
+        std::cout << "start[" << std::setw(5) << k << "]: "
+                  << std::setw(5) << iters[k] << " iterations, "
+                  << std::setw(7) << evals[k] << " funevals, f(x) = "
+                  << std::setw(15) << std::setprecision(7)
+                  << std::scientific << fEnd[k] << "\n";
+    }
+
+    std::cout << "\n\n\nBEST OF " << nStarts << " STARTS IS start["
+              << best << "], HOOKE USED " << iters[best]
+              << " ITERATIONS, AND RETURNED\n";
+
+    for (i = 0; i < nVars; i++) {
+        std::cout << "x[" << std::setw(3) << i << "] = " << std::setw(15)
+                  << endPts[best * nVars + i] << " \n";
+    }
+}
+
+/**
+ * Helper function.
+ * <br />
+ * <br />Runs the batch mode: solves every row of the start-point file
+ * <code>batchIn</code> on a pool of <code>nThreads</code> threads
+ * and streams the solutions to the result file <code>batchOut</code>
+ * (laid out as <code>batchFmt</code> tells, or as the start-point file).
+ * The rows not carrying rho and epsilon get the problem's rho
+ * and the <code>epsilon</code> of the options.
+ * <br />
+ * <br />If the rows name their problems (see <code>StartFile</code>),
+ * each of them is solved by the solvers of its problem in the registry
+ * of the options instead, whatever the problem picked.
+ *
+ * @param problem The problem.
+ * @param opts    The command-line options.
+ *
+ * @return The exit status (a failure if the rows are not as wide
+ *         as the objective function takes).
+ */
+template<typename Objective, unsigned int N>
+int runBatch(const Problem &problem, const Options &opts) {
+    unsigned long long nRows;
+
+    unsigned int k;
+    unsigned int nVars;
+
+    bool binary;
+
+    const char *prog    = opts.prog;
+    const char *inPath  = opts.batchIn;
+    const char *outPath = opts.batchOut;
+    const char *outFmt  = opts.batchFmt;
+
+    double       rho      = problem.rho;
+    double       epsilon  = opts.epsilon;
+    unsigned int iterMax  = opts.iterMax;
+    unsigned int nThreads = opts.nThreads;
+    PollMode     poll     = opts.poll;
+
+    StartFile    in;
+    ResultWriter out;
+
+    std::vector<std::string> names;
+    std::vector<Solvers *>   solvers;
+    std::vector<double>      rhos;
+
+    if (!in.open(inPath)) {
+        std::cerr << prog << ": " << inPath
+                  << ": cannot read, or not a start-point file\n";
+
+        return EXIT_FAILURE;
+    }
+
+    nVars = in.getNVars();
+
+    // The worker processes evaluate the one problem they were started for.
+    if (in.isNamed() && (opts.remote != NULL)) {
+        std::cerr << prog << ": " << inPath << ": the rows name"
+                     " their problems, which --remote does not take\n";
+
+        return EXIT_FAILURE;
+    }
+
+    // The fixed-dimension objectives would read past the end of a row.
+    if (!in.isNamed()
+        && ((nVars < problem.minVars) || (nVars > problem.maxVars))) {
+
+        std::cerr << prog << ": " << inPath << ": " << nVars
+                  << " variables per row, " << problem.name << " takes ";
+
+        if (problem.minVars == problem.maxVars) {
+            std::cerr << problem.minVars << "\n";
+        } else if (problem.maxVars == UNBOUNDED_VARS) {
+            std::cerr << "at least " << problem.minVars << "\n";
+        } else {
+            std::cerr << problem.minVars << " to " << problem.maxVars << "\n";
+        }
+
+        return EXIT_FAILURE;
+    }
+
+    binary = (outFmt == NULL) ? in.isBinary()
+                              : (std::strcmp(outFmt, "binary") == 0);
+
+    if (!out.open(outPath, in.getNVars(), binary)) {
+        std::cerr << prog << ": cannot open " << outPath << "\n";
+
+        return EXIT_FAILURE;
+    }
+
+    ThreadPool pool(nThreads);
+
+    /*
+     * The rows naming their problems may name any registered one
+     * that takes their number of variables (a row naming another one
+     * is a malformed one); the others are all the problem's.
+     */
+    if (in.isNamed()) {
+        for (k = 0; k < opts.nProblems; k++) {
+            const Problem &p = opts.problems[k];
+
+            if ((nVars >= p.minVars) && (nVars <= p.maxVars)) {
+                names.push_back(p.name);
+                solvers.push_back(p.solvers(pool.size(), nVars));
+                rhos.push_back(p.rho);
+            }
+        }
+
+        in.setProblems(names);
+    } else {
+        solvers.push_back(newSolvers<Objective, N>(pool.size(), nVars));
+        rhos.push_back(rho);
+    }
+
+    for (k = 0; k < solvers.size(); k++) {
+        solvers[k]->setPoll(poll);
+    }
+
+    BatchSolve bs(pool, solvers);
+
+    nRows = bs.batchSolve(in, out, &rhos[0], epsilon, iterMax);
+
+    for (k = 0; k < solvers.size(); k++) {
+        delete solvers[k];
+    }
+
+    if (!out.close()) {
+        std::cerr << prog << ": cannot write " << outPath << "\n";
+
+        return EXIT_FAILURE;
+    }
+
+    if (in.isMalformed()) {
+        std::cerr << prog << ": " << inPath << ": malformed row";
+
+        if (!in.isBinary()) {
+            std::cerr << " at line " << in.getLine();
+        }
+
+        if (in.isNamed()) {
+            std::cerr << ", or its problem is not one taking " << nVars
+                      << " variables";
+        }
+
+        std::cerr << " (" << nRows << " rows solved)\n";
+
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "\nBATCH: " << nRows << " ROWS OF " << in.getNVars()
+              << " VARIABLES ON " << pool.size() << " THREADS\n";
+
+    return EXIT_SUCCESS;
+}
+
+/**
+ * Helper function.
+ * <br />
+ * <br />Runs the benchmark mode: solves the problem from its standard
+ * starting guess <code>nReps</code> times and prints one row
+ * of the benchmark table (see <code>BENCH_HEADER</code>): the number
+ * of iterations and of function evaluations, the best wall time
+ * of a solve, and f(x) at the ending point.
+ *
+ * @param problem The problem.
+ * @param opts    The command-line options.
+ *
+ * @return The exit status.
+ */
+template<typename Objective, unsigned int N>
+int runBench(const Problem &problem, const Options &opts) {
+    unsigned int r;
+    unsigned int jj = 0;
+
+    double endPt[VARS];
+    double best = 0.0;
+
+    unsigned long long evals = 0;
+
+    Objective objective;
+    FunEvals  fe;
+
+    Hooke<Objective, N> h;
+
+    ThreadPool *pool = NULL;
+
+    if (opts.poll != POLL_OPPORTUNISTIC) {
+        pool = new ThreadPool(opts.nThreads);
+    }
+
+    h.setPoll(opts.poll, pool);
+    h.setIncremental(opts.incr);
+    h.setEarlyAbort(opts.abort);
+    h.setTrace(false);
+
+    for (r = 0; r < opts.nReps; r++) {
+        FunEvals solveEvals;
+
+        std::chrono::steady_clock::time_point t0
+            = std::chrono::steady_clock::now();
+
+        jj = h.hooke(problem.nVars, problem.startPt, endPt, problem.rho,
+                     opts.epsilon, opts.iterMax, &solveEvals);
+
+        std::chrono::duration<double> t
+            = std::chrono::steady_clock::now() - t0;
+
+        if ((r == 0) || (t.count() < best)) {
+            best = t.count();
+        }
+
+        evals = solveEvals.getFunEvals();
+    }
+
+    delete pool;
+
+    std::cout << std::left << std::setw(BENCH_NAME_WIDTH) << problem.name
+              << std::right << std::setw(4) << problem.nVars
+              << std::setw(9) << jj << std::setw(11) << evals
+              << std::setw(13) << std::fixed << std::setprecision(6) << best
+              << std::setw(15) << std::scientific
+              << objective.f(endPt, problem.nVars, &fe) << "\n";
+
+    return EXIT_SUCCESS;
+}
+
+// Makes the per-worker solvers of the batch mode for an objective function.
+template<typename Objective, unsigned int N>
+Solvers *newSolvers(const unsigned int workers, const unsigned int nVars) {
+    // The rows of the objective's own dimension get the fixed-size solver.
+    if (nVars == N) {
+        return new SolverSet<Objective, N>(workers, Objective());
+    }
+
+    return new SolverSet<Objective>(workers, Objective());
+}
+
+// Solves a problem in the mode the options ask for.
+template<typename Objective, unsigned int N>
+int runProblem(const Problem &problem, const Options &opts) {
+    unsigned int i;
+    unsigned int jj;
+    unsigned int nVars   = problem.nVars;
+    unsigned int iterMax = opts.iterMax;
+
+    double rho     = problem.rho;
+    double epsilon = opts.epsilon;
+    double endPt[VARS];
+
+    const double *startPt = problem.startPt;
+
+    // The ending points of the single solves live on the stack.
+    if (nVars > VARS) {
+        std::cerr << opts.prog << ": " << problem.name << ": " << nVars
+                  << " variables, the limit is " << VARS << "\n";
+
+        return EXIT_FAILURE;
+    }
+
+    // Benchmark mode: a row of the table, no trace.
+    if (opts.nReps > 0) {
+        return runBench<Objective, N>(problem, opts);
+    }
+
+    // Batch mode: the starting points of a file, solved on a thread pool.
+    if (opts.batchIn != NULL) {
+        return runBatch<Objective, N>(problem, opts);
+    }
+
+    // Multi-start mode: K starting points solved on a thread pool.
+    if (opts.nStarts > 0) {
+        runMultiStart<Objective, N>(
+            nVars, startPt, rho, epsilon, iterMax, opts.nStarts,
+            opts.nThreads, opts.poll, opts.nLanes);
+
+        return EXIT_SUCCESS;
+    }
+
+    /*
+     * Instantiating the Hooke class template, specialized
+     * for the objective function and its number of variables.
+     */
+    Hooke<Objective, N> *h = new Hooke<Objective, N>();
+
+    // The concurrent poll strategies get a thread pool of their own.
+    ThreadPool *pool = NULL;
+
+    if (opts.poll != POLL_OPPORTUNISTIC) {
+        pool = new ThreadPool(opts.nThreads);
+    }
+
+    h->setPoll(opts.poll, pool);
+
+    // The evaluation cache, if asked for.
+    EvalCache *cache = NULL;
+
+    if (opts.nCache > 0) {
+        cache = new EvalCache(nVars, opts.nCache);
+    }
+
+    h->setCache(cache);
+    h->setIncremental(opts.incr);
+    h->setEarlyAbort(opts.abort);
+
+    // The trace goes to the standard output, unless a file is given.
+    std::vector<char> traceBuffer; // Has to outlive the file stream.
+    std::ofstream     traceFile;
+
+    if (opts.traceTo != NULL) {
+        // The binary records go out through a large stream buffer.
+        if (opts.format == TRACE_BINARY) {
+            traceBuffer.resize(BIN_TRACE_BUFFER_SIZE);
+
+            traceFile.rdbuf()->pubsetbuf(&traceBuffer[0],
+                                         traceBuffer.size());
+
+            traceFile.open(opts.traceTo, std::ios::out | std::ios::binary);
+        } else {
+            traceFile.open(opts.traceTo);
+        }
+
+        if (!traceFile) {
+            std::cerr << opts.prog << ": cannot open " << opts.traceTo
+                      << "\n";
+
+            delete h;
+            delete pool;
+            delete cache;
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::ostream &traceOut = (opts.traceTo != NULL) ? traceFile : std::cout;
+
+    // The asynchronous trace gets its records written by a thread of its own.
+    AsyncTrace *asyncTracer = NULL;
+    Trace      *tracer;
+
+    if (opts.async) {
+        tracer = asyncTracer = new AsyncTrace(nVars, opts.policy,
+                                              TRACE_RING_RECORDS, traceOut,
+                                              opts.level, opts.format,
+                                              opts.every);
+    } else if (opts.format == TRACE_BINARY) {
+        tracer = new BinaryTrace(traceOut, nVars, rho, epsilon, opts.level,
+                                 opts.every);
+    } else {
+        tracer = new Trace(traceOut, opts.level, opts.format, opts.every);
+    }
+
+    h->setTrace(opts.level != TRACE_NONE);
+    h->setTracer(tracer);
+
+    FunEvals fe;
+
+    jj = h->hooke(nVars, startPt, endPt, rho, epsilon, iterMax, &fe);
+
+    std::cout << "\n\n\nHOOKE USED " << jj << " ITERATIONS, AND RETURNED\n";
+
+    for (i = 0; i < nVars; i++) {
+        std::cout << "x[" << std::setw(3) << i << "] = " << std::setw(15)
+                  << std::setprecision(7) << std::scientific << endPt[i]
+                  << " \n";
+    }
+
+    if (problem.answer != NULL) {
+        std::cout << problem.answer << std::endl;
+    }
+
+    if (opts.poll == POLL_SPECULATIVE) {
+        std::cout << "Speculative evaluations wasted: "
+                  << fe.get(WASTED_EVALS) << std::endl;
+    }
+
+    if (opts.abort) {
+        std::cout << "Early-aborted evaluations: "
+                  << fe.get(REJECTED_EVALS) << std::endl;
+    }
+
+    if (opts.async && (opts.policy == TRACE_DROP)) {
+        std::cout << "Trace records dropped: " << asyncTracer->getDropped()
+                  << std::endl;
+    }
+
+    if (cache != NULL) {
+        std::cout << "Evaluation cache: " << fe.get(CACHE_HITS) << " hits, "
+                  << fe.get(CACHE_MISSES) << " misses" << std::endl;
+    }
+
+    // Destroying the Hooke class instance (and its helpers, if any).
+    delete h;
+    delete pool;
+    delete cache;
+    delete tracer;
+
+    return EXIT_SUCCESS;
+}
+
+} // namespace NLPUCCLIHooke
+
+#endif // __CC__RUNNER_H
+
+// vim:set nu et ts=4 sw=4:
@@ -0,0 +1,40 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/runwoods.cc
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#include "woods.h"
+#include "runner.h"
+
+// The NLPUCCLIHooke namespace.
+namespace NLPUCCLIHooke {
+
+// The runner of the problems of the Woods objective function.
+template int runProblem<Woods, Woods::NVARS>(const Problem &,
+                                             const Options &);
+
+// The solvers of its batch mode.
+template Solvers *newSolvers<Woods, Woods::NVARS>(
+    const unsigned int, const unsigned int);
+
+} // namespace NLPUCCLIHooke
+
+// vim:set nu et ts=4 sw=4:
@@ -0,0 +1,362 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/scalesweep.cc
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <new>
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "rosenbrock.h"
+#include "woods.h"
+#include "hooke.h"
+
+using namespace NLPUCCLIHooke;
+
+// Helper constants.
+const unsigned int SCALE_DIMS[]   = {
+    2, 4, 8, 16, 32, 64, 128, 250, 256, 512, 1024
+};
+const unsigned int SCALE_N_DIMS   = sizeof(SCALE_DIMS)
+                                  / sizeof(SCALE_DIMS[0]);
+const double       SCALE_RHOS[]   = {.25, .5, .75};
+const unsigned int SCALE_N_RHOS   = sizeof(SCALE_RHOS)
+                                  / sizeof(SCALE_RHOS[0]);
+// (No vars_limit column, unlike nelmin's: the VARS limit is the one
+// of the problems set up in main(), the engine itself has none.)
+const char         SCALE_HEADER[] = "solver,func,n,rho,status,iters,"
+                                    "funevals,seconds,evals_per_s,f,"
+                                    "peak_rss_kib,allocs";
+
+/** The outcome of a cell of the sweep (see <code>SCALE_STATUS</code>). */
+enum ScaleStatus {
+    SCALE_OK,
+    SCALE_MAX_ITERS,
+    SCALE_CRASHED
+};
+
+/** The names of the outcomes (as the CSV has them). */
+const char *const SCALE_STATUS[] = {"ok", "max-iters", "crashed"};
+
+/**
+ * The results of a cell of the sweep (passed from the solving process
+ * back to the sweeping one as is).
+ */
+struct ScaleCell {
+    /** The outcome (<code>ScaleStatus</code>). */
+    unsigned int status;
+
+    /** The number of iterations. */
+    unsigned int iters;
+
+    /** The number of function evaluations. */
+    unsigned long long evals;
+
+    /** The number of heap allocations made by the solve. */
+    unsigned long long allocs;
+
+    /** The wall time of the solve. */
+    double seconds;
+
+    /** The objective function value at the ending point. */
+    double f;
+};
+
+// Helper variable (the number of heap allocations made so far).
+static unsigned long long allocs;
+
+extern "C" {
+
+void *__real_malloc(std::size_t);
+int   __real_posix_memalign(void **, std::size_t, std::size_t);
+
+// The allocation function the linker binds the malloc() calls to
+// (see the -Wl,--wrap=malloc option in the Makefile): counts them.
+void *__wrap_malloc(std::size_t size) {
+    allocs++;
+
+    return __real_malloc(size);
+}
+
+// The aligned allocation function the linker binds the posix_memalign()
+// calls to (the workspace arenas): counts them.
+int __wrap_posix_memalign(void **p, std::size_t align, std::size_t size) {
+    allocs++;
+
+    return __real_posix_memalign(p, align, size);
+}
+
+} // extern "C"
+
+// The global allocation function: goes through the counting malloc()
+// (the library's own one calls the unwrapped malloc()).
+void *operator new(std::size_t size) {
+    void *p = std::malloc((size == 0) ? 1 : size);
+
+    if (p == NULL) {
+        throw std::bad_alloc();
+    }
+
+    return p;
+}
+
+// The global deallocation function.
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+/**
+ * Helper function.
+ * <br />
+ * <br />Matches a command-line option of the form <code>--name=value</code>.
+ *
+ * @param arg  The command-line argument.
+ * @param name The option name (including the leading dashes).
+ *
+ * @return The option value, or <code>NULL</code> if the argument
+ *         is not the option given.
+ */
+static const char *optionValue(const char *arg, const char *name) {
+    std::size_t len = std::strlen(name);
+
+    if ((std::strncmp(arg, name, len) != 0) || (arg[len] != '=')) {
+        return NULL;
+    }
+
+    return (arg + len + 1);
+}
+
+/**
+ * Helper function.
+ * <br />
+ * <br />Solves a problem once, the way the runtime-N engine is used
+ * (a solver of its own, no workspace handed over).
+ *
+ * @param nVars   The number of variables.
+ * @param startPt The starting point coordinates.
+ * @param rho     The rho value.
+ * @param iterMax The maximum number of iterations.
+ * @param cell    The results (output).
+ */
+template<typename Objective>
+static void solve(const unsigned int nVars,
+                  const double *startPt,
+                  const double rho,
+                  const unsigned int iterMax,
+                  ScaleCell *cell) {
+
+    std::vector<double> endPt(nVars);
+
+    FunEvals fe;
+    FunEvals fx;
+
+    Hooke<Objective> h;
+
+    h.setTrace(false);
+
+    allocs = 0;
+
+    std::chrono::steady_clock::time_point t0
+        = std::chrono::steady_clock::now();
+
+    cell->iters = h.hooke(nVars, startPt, &endPt[0], rho, EPSMIN, iterMax,
+                          &fe);
+
+    std::chrono::duration<double> t = std::chrono::steady_clock::now() - t0;
+
+    cell->allocs  = allocs;
+    cell->seconds = t.count();
+    cell->evals   = fe.getFunEvals();
+    cell->status  = (cell->iters < iterMax) ? SCALE_OK : SCALE_MAX_ITERS;
+
+    // Scoring the ending point is not counted as a solver's eval.
+    cell->f = Objective::f(&endPt[0], nVars, &fx);
+}
+
+/**
+ * Helper function.
+ * <br />
+ * <br />Runs a cell of the sweep in a child process, so that the peak
+ * resident set is the one of the solve alone and a solve which
+ * crashes shows up as such, and prints its CSV row.
+ *
+ * @param name    The problem name.
+ * @param nVars   The number of variables.
+ * @param startPt The starting point coordinates.
+ * @param rho     The rho value.
+ * @param iterMax The maximum number of iterations.
+ * @param out     The CSV stream.
+ *
+ * @return <code>false</code> if the child cannot be started.
+ */
+template<typename Objective>
+static bool cell(const char *name,
+                 const unsigned int nVars,
+                 const double *startPt,
+                 const double rho,
+                 const unsigned int iterMax,
+                 std::FILE *out) {
+
+    int fds[2];
+    int status;
+
+    pid_t pid;
+
+    struct rusage usage;
+
+    ScaleCell c;
+
+    if (pipe(fds) != 0) {
+        return false;
+    }
+
+    // Nothing buffered must get written twice.
+    std::fflush(out);
+
+    if ((pid = fork()) < 0) {
+        close(fds[0]);
+        close(fds[1]);
+
+        return false;
+    }
+
+    if (pid == 0) {
+        close(fds[0]);
+
+        solve<Objective>(nVars, startPt, rho, iterMax, &c);
+
+        _exit((write(fds[1], &c, sizeof(c)) == sizeof(c))
+              ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    close(fds[1]);
+
+    if (read(fds[0], &c, sizeof(c)) != sizeof(c)) {
+        std::memset(&c, 0, sizeof(c));
+
+        c.status = SCALE_CRASHED;
+    }
+
+    close(fds[0]);
+
+    if (wait4(pid, &status, 0, &usage) < 0) {
+        std::memset(&usage, 0, sizeof(usage));
+    }
+
+    std::fprintf(out, "hooke,%s,%u,%g,%s,%u,%llu,%.6f,%.6e,%.17g,%ld,%llu\n",
+                 name, nVars, rho, SCALE_STATUS[c.status], c.iters,
+                 c.evals, c.seconds,
+                 (c.seconds > 0) ? (c.evals / c.seconds) : 0.0, c.f,
+                 usage.ru_maxrss, c.allocs);
+
+    return true;
+}
+
+// Main program function main() :-).
+int main(int argc, char **argv) {
+    int arg;
+
+    unsigned int d;
+    unsigned int r;
+    unsigned int i;
+    unsigned int maxVars = SCALE_DIMS[SCALE_N_DIMS - 1];
+    unsigned int iterMax = IMAX;
+
+    bool header = true;
+    bool ok     = true;
+
+    const char *value;
+    const char *csv = NULL;
+
+    std::FILE *out = stdout;
+
+    for (arg = 1; arg < argc; arg++) {
+        if (std::strcmp(argv[arg], "--no-header") == 0) {
+            header = false;
+        } else if ((value = optionValue(argv[arg], "--max-vars")) != NULL) {
+            maxVars = std::strtoul(value, NULL, 10);
+        } else if (((value = optionValue(argv[arg], "--iters")) != NULL)
+                && (std::strtoul(value, NULL, 10) > 0)) {
+
+            iterMax = std::strtoul(value, NULL, 10);
+        } else if ((value = optionValue(argv[arg], "--csv")) != NULL) {
+            csv = value;
+        } else {
+            std::fprintf(stderr, "Usage: %s [--max-vars=N] [--iters=N]"
+                                 " [--csv=FILE] [--no-header]\n", argv[0]);
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    if ((csv != NULL) && ((out = std::fopen(csv, "w")) == NULL)) {
+        std::fprintf(stderr, "%s: cannot write %s\n", argv[0], csv);
+
+        return EXIT_FAILURE;
+    }
+
+    if (header) {
+        std::fprintf(out, "%s\n", SCALE_HEADER);
+    }
+
+    for (d = 0; ok && (d < SCALE_N_DIMS) && (SCALE_DIMS[d] <= maxVars); d++) {
+        unsigned int n = SCALE_DIMS[d];
+
+        std::vector<double> rosenStart(n);
+        std::vector<double> woodsStart(n);
+
+        for (i = 0; i < n; i++) {
+            rosenStart[i] = (i % 2 == 0) ? MINUS_ONE_POINT_TWO
+                                         : ONE_POINT_ZERO;
+            woodsStart[i] = (i % 2 == 0) ? MINUS_THREE : MINUS_ONE;
+        }
+
+        for (r = 0; ok && (r < SCALE_N_RHOS); r++) {
+            ok = cell<Rosenbrock>("rosenbrock", n, &rosenStart[0],
+                                  SCALE_RHOS[r], iterMax, out);
+
+            // The extended Woods function takes whole blocks only.
+            if (ok && (n % Woods::NVARS == 0)) {
+                ok = cell<Woods>("woods", n, &woodsStart[0], SCALE_RHOS[r],
+                                 iterMax, out);
+            }
+        }
+    }
+
+    if (!ok) {
+        std::fprintf(stderr, "%s: cannot start a solve\n", argv[0]);
+    }
+
+    if ((out != stdout) && (std::fclose(out) != 0)) {
+        std::fprintf(stderr, "%s: cannot write %s\n", argv[0], csv);
+
+        ok = false;
+    }
+
+    return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+// vim:set nu et ts=4 sw=4:
@@ -0,0 +1,287 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/solverset.h
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#ifndef __CC__SOLVERSET_H
+#define __CC__SOLVERSET_H
+
+#include <vector>
+
+#include "hooke.h"
+
+/**
+ * The <code>NLPUCCLIHooke</code> namespace is used as a container
+ * for the <code>Solvers</code> and <code>SolverSet</code> classes.
+ */
+namespace NLPUCCLIHooke {
+
+/**
+ * The <code>Solvers</code> class is the interface of a set of per-worker
+ * solver instances, whatever objective function they are specialized
+ * for, so that <code>BatchSolve</code> can hand each row of a batch
+ * to the solvers of the problem the row names.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @see     SolverSet
+ * @see     BatchSolve
+ * @since   hooke-jeeves 0.1
+ */
+class Solvers {
+public:
+    /**
+     * Makes the workspace of every worker fit a number of variables
+     * (to be called before the solves are queued).
+     *
+     * @param nVars The number of variables.
+     */
+    virtual void fit(const unsigned int) = 0;
+
+    /**
+     * Main optimization method.
+     * <br />
+     * <br />Solves the problem from a starting point on a worker's
+     * solver instances and scores the ending point (which is not
+     * counted as a solver's evaluation).
+     *
+     * @param w       The worker.
+     * @param nVars   The number of variables.
+     * @param startPt The starting point coordinates.
+     * @param endPt   The ending point coordinates.
+     * @param rho     The rho value.
+     * @param epsilon The epsilon value.
+     * @param iterMax The maximum number of iterations.
+     * @param evals   The number of function evaluations (output).
+     * @param fEnd    The objective function value at the ending point
+     *                (output).
+     *
+     * @return The number of iterations used to find the local minimum.
+     */
+    virtual unsigned int solve(const unsigned int,
+                               const unsigned int,
+                               const double *,
+                               double *,
+                               const double,
+                               const double,
+                               const unsigned int,
+                               unsigned int *,
+                               double *) = 0;
+
+    /**
+     * Setter for the exploratory move strategy of every solve.
+     *
+     * @param __poll The exploratory move strategy.
+     */
+    virtual void setPoll(const PollMode) = 0;
+
+    /** Destructor. */
+    virtual ~Solvers() {}
+};
+
+/**
+ * The <code>SolverSet</code> class template holds the per-worker solver
+ * instances of the drivers that spread independent solves across
+ * a thread pool (<code>MultiStart</code>, <code>BatchSolve</code>).
+ * <br />
+ * <br />Every worker owns its <code>Hooke</code>, its two
+ * <code>FunEvals</code> (the solve's one and the one the ending point
+ * is scored with), its <code>Workspace</code> and an objective function
+ * provider, so nothing is shared between the solves, and the solves
+ * after the first one on a worker allocate nothing.
+ *
+ * @param Objective The class providing the objective function.
+ * @param N         The number of variables, or <code>DYNAMIC_VARS</code>.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @see     MultiStart
+ * @see     BatchSolve
+ * @see     Solvers
+ * @since   hooke-jeeves 0.1
+ */
+template<typename Objective, unsigned int N = DYNAMIC_VARS>
+class SolverSet : public Solvers {
+private:
+    /** The per-worker solver instances. */
+    std::vector<Hooke<Objective, N> *> hookes;
+
+    /** The per-worker number of function evaluations containers. */
+    std::vector<FunEvals *> funEvals;
+
+    /** The per-worker containers the ending point scoring counts into. */
+    std::vector<FunEvals *> scoreEvals;
+
+    /** The per-worker solver workspaces (sized by <code>fit()</code>). */
+    std::vector<Workspace *> workspaces;
+
+    /** The per-worker objective function providers. */
+    std::vector<Objective> objectives;
+
+    /** Copying is not allowed. */
+    SolverSet(const SolverSet &);
+    SolverSet &operator=(const SolverSet &);
+
+public:
+    /**
+     * Makes the workspace of every worker fit a number of variables
+     * (to be called before the solves are queued).
+     *
+     * @param nVars The number of variables.
+     */
+    void fit(const unsigned int);
+
+    /**
+     * Main optimization method.
+     * <br />
+     * <br />Solves the problem from a starting point on a worker's
+     * solver instances and scores the ending point (which is not
+     * counted as a solver's evaluation).
+     *
+     * @param w       The worker.
+     * @param nVars   The number of variables.
+     * @param startPt The starting point coordinates.
+     * @param endPt   The ending point coordinates.
+     * @param rho     The rho value.
+     * @param epsilon The epsilon value.
+     * @param iterMax The maximum number of iterations.
+     * @param evals   The number of function evaluations (output).
+     * @param fEnd    The objective function value at the ending point
+     *                (output).
+     *
+     * @return The number of iterations used to find the local minimum.
+     */
+    unsigned int solve(const unsigned int,
+                       const unsigned int,
+                       const double *,
+                       double *,
+                       const double,
+                       const double,
+                       const unsigned int,
+                       unsigned int *,
+                       double *);
+
+    /**
+     * Setter for the exploratory move strategy of every solve.
+     *
+     * @param __poll The exploratory move strategy.
+     */
+    void setPoll(const PollMode);
+
+    /**
+     * Constructor.
+     *
+     * @param __workers   The number of workers.
+     * @param __objective The objective function provider.
+     */
+    SolverSet(const unsigned int, const Objective &);
+
+    /** Destructor. */
+    ~SolverSet();
+};
+
+// Makes the workspace of every worker fit a number of variables.
+template<typename Objective, unsigned int N>
+void SolverSet<Objective, N>::fit(const unsigned int nVars) {
+    unsigned int w;
+
+    for (w = 0; w < workspaces.size(); w++) {
+        if ((workspaces[w] == NULL) || !workspaces[w]->fits(nVars, 1)) {
+            delete workspaces[w];
+
+            workspaces[w] = new Workspace(nVars);
+
+            hookes[w]->setWorkspace(workspaces[w]);
+        }
+    }
+}
+
+// Main optimization method solve(...).
+template<typename Objective, unsigned int N>
+unsigned int SolverSet<Objective, N>::solve(const unsigned int w,
+                                            const unsigned int nVars,
+                                            const double *startPt,
+                                            double *endPt,
+                                            const double rho,
+                                            const double epsilon,
+                                            const unsigned int iterMax,
+                                            unsigned int *evals,
+                                            double *fEnd) {
+
+    unsigned int iters;
+
+    funEvals[w]->reset();
+
+    iters = hookes[w]->hooke(nVars, startPt, endPt, rho, epsilon, iterMax,
+                             funEvals[w]);
+
+    *evals = funEvals[w]->getFunEvals();
+    *fEnd  = objectives[w].f(endPt, nVars, scoreEvals[w]);
+
+    return iters;
+}
+
+// Setter for the exploratory move strategy of every solve.
+template<typename Objective, unsigned int N>
+void SolverSet<Objective, N>::setPoll(const PollMode __poll) {
+    unsigned int w;
+
+    for (w = 0; w < hookes.size(); w++) {
+        hookes[w]->setPoll(__poll);
+    }
+}
+
+// Constructor.
+template<typename Objective, unsigned int N>
+SolverSet<Objective, N>::SolverSet(const unsigned int __workers,
+                                   const Objective &__objective)
+    : objectives(__workers, __objective) {
+
+    unsigned int w;
+
+    for (w = 0; w < __workers; w++) {
+        hookes.push_back(new Hooke<Objective, N>(__objective));
+        funEvals.push_back(new FunEvals());
+        scoreEvals.push_back(new FunEvals());
+        workspaces.push_back(NULL);
+
+        hookes[w]->setTrace(false);
+    }
+}
+
+// Destructor.
+template<typename Objective, unsigned int N>
+SolverSet<Objective, N>::~SolverSet() {
+    unsigned int w;
+
+    for (w = 0; w < hookes.size(); w++) {
+        delete hookes[w];
+        delete funEvals[w];
+        delete scoreEvals[w];
+        delete workspaces[w];
+    }
+}
+
+} // namespace NLPUCCLIHooke
+
+#endif // __CC__SOLVERSET_H
+
+// vim:set nu et ts=4 sw=4:
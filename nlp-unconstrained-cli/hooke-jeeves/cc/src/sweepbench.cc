@@ -0,0 +1,133 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/sweepbench.cc
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+#include "rosenbrock.h"
+#include "woods.h"
+#include "hooke.h"
+
+using namespace NLPUCCLIHooke;
+
+// Helper constants (every probe evaluates f(x) from scratch, so the sweeps
+// cost O(n^2) and the dimensions stay small).
+const unsigned int BENCH_ITER_MAX = 50;
+const unsigned int BENCH_DIMS[]   = {4, 10, 100, 1000};
+const unsigned int BENCH_N_DIMS   = sizeof(BENCH_DIMS) / sizeof(BENCH_DIMS[0]);
+
+/**
+ * Helper function.
+ * <br />
+ * <br />Solves the extended problem from its standard starting guess
+ * once with the full-vector copy sweeps and once with the in-place ones
+ * (both evaluating f(x) from scratch), and reports the work array
+ * traffic per exploratory sweep of both.
+ *
+ * @param name    The problem name.
+ * @param nVars   The number of variables.
+ * @param startPt The starting point coordinates.
+ * @param rho     The rho value.
+ */
+template<typename Objective>
+static void bench(const char *name,
+                  const unsigned int nVars,
+                  const double *startPt,
+                  const double rho) {
+
+    unsigned int mode;
+
+    std::vector<double> endPts(2 * nVars);
+
+    Hooke<Objective> h;
+    Workspace ws(nVars);
+
+    /*
+     * The plain sweeps (the incremental ones have a sweep of their own):
+     * the copy row is the solver as it was before the in-place sweeps.
+     */
+    h.setTrace(false);
+    h.setIncremental(false);
+    h.setWorkspace(&ws);
+
+    for (mode = 0; mode < 2; mode++) {
+        FunEvals fe;
+
+        h.setInPlace(mode == 1);
+
+        std::chrono::steady_clock::time_point t0
+            = std::chrono::steady_clock::now();
+
+        h.hooke(nVars, startPt, &endPts[mode * nVars], rho, EPSMIN,
+                BENCH_ITER_MAX, &fe);
+
+        std::chrono::duration<double> t
+            = std::chrono::steady_clock::now() - t0;
+
+        std::cout << std::setw(10) << name << std::setw(9) << nVars
+                  << std::setw(9) << ((mode == 1) ? "in-place" : "copy")
+                  << std::setw(8) << fe.get(SWEEPS)
+                  << std::setw(16) << std::fixed << std::setprecision(1)
+                  << ((double) fe.get(BYTES_MOVED) / fe.get(SWEEPS))
+                  << std::setw(12) << std::setprecision(6) << t.count();
+
+        if (mode == 1) {
+            std::cout << ((std::memcmp(&endPts[0], &endPts[nVars],
+                                       nVars * sizeof(double)) == 0)
+                          ? "  same result" : "  RESULTS DIFFER");
+        }
+
+        std::cout << "\n";
+    }
+}
+
+// Main program function main() :-).
+int main() {
+    unsigned int d;
+    unsigned int i;
+
+    std::cout << "      func        n     mode  sweeps  bytes / sweep"
+                 "     seconds\n";
+
+    for (d = 0; d < BENCH_N_DIMS; d++) {
+        std::vector<double> startPt(BENCH_DIMS[d]);
+
+        for (i = 0; i < BENCH_DIMS[d]; i++) {
+            startPt[i] = (i % 2 == 0) ? MINUS_ONE_POINT_TWO : ONE_POINT_ZERO;
+        }
+
+        bench<Rosenbrock>("rosenbrock", BENCH_DIMS[d], &startPt[0],
+                          RHO_BEGIN);
+
+        for (i = 0; i < BENCH_DIMS[d]; i++) {
+            startPt[i] = (i % 2 == 0) ? MINUS_THREE : MINUS_ONE;
+        }
+
+        bench<Woods>("woods", BENCH_DIMS[d], &startPt[0], RHO_WOODS);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+// vim:set nu et ts=4 sw=4:
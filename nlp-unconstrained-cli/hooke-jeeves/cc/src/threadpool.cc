@@ -0,0 +1,183 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/threadpool.cc
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#include "threadpool.h"
+
+// The NLPUCCLIHooke namespace.
+namespace NLPUCCLIHooke {
+
+// Helper method take(...).
+bool ThreadPool::take(const unsigned int index, Task &task) {
+    unsigned int i;
+    unsigned int victim;
+    unsigned int nWorkers = workers.size();
+
+    // Own deque first: LIFO, the most recently queued task is the hottest.
+    {
+        std::lock_guard<std::mutex> guard(workers[index]->mutex);
+
+        if (!workers[index]->tasks.empty()) {
+            task = workers[index]->tasks.back();
+
+            workers[index]->tasks.pop_back();
+
+            queued--;
+
+            return true;
+        }
+    }
+
+    // Then steal the oldest task of somebody else.
+    for (i = 1; i < nWorkers; i++) {
+        victim = (index + i) % nWorkers;
+
+        std::lock_guard<std::mutex> guard(workers[victim]->mutex);
+
+        if (!workers[victim]->tasks.empty()) {
+            task = workers[victim]->tasks.front();
+
+            workers[victim]->tasks.pop_front();
+
+            queued--;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Helper method run(...).
+void ThreadPool::run(const unsigned int index) {
+    Task task;
+
+    for (;;) {
+        if (take(index, task)) {
+            task(index);
+
+            task = Task();
+
+            if (pending.fetch_sub(1) == 1) {
+                std::lock_guard<std::mutex> guard(lock);
+
+                allDone.notify_all();
+            }
+
+            continue;
+        }
+
+        std::unique_lock<std::mutex> guard(lock);
+
+        while (!stopping && (queued.load() == 0)) {
+            wakeUp.wait(guard);
+        }
+
+        if (stopping && (queued.load() == 0)) {
+            return;
+        }
+    }
+}
+
+// Getter for the number of worker threads.
+unsigned int ThreadPool::size() const {
+    return threads.size();
+}
+
+// Submits a task to the pool.
+void ThreadPool::submit(const Task &task) {
+    unsigned int index = next.fetch_add(1) % workers.size();
+
+    pending++;
+
+    {
+        std::lock_guard<std::mutex> guard(workers[index]->mutex);
+
+        workers[index]->tasks.push_back(task);
+
+        queued++;
+    }
+
+    std::lock_guard<std::mutex> guard(lock);
+
+    wakeUp.notify_one();
+}
+
+// Blocks until all the submitted tasks are completed.
+void ThreadPool::wait() {
+    std::unique_lock<std::mutex> guard(lock);
+
+    while (pending.load() != 0) {
+        allDone.wait(guard);
+    }
+}
+
+// Constructor.
+ThreadPool::ThreadPool(const unsigned int nThreads)
+    : pending(0), queued(0), next(0), stopping(false) {
+
+    unsigned int i;
+    unsigned int n = nThreads;
+
+    if (n == 0) {
+        n = std::thread::hardware_concurrency();
+    }
+
+    if (n == 0) {
+        n = 1;
+    }
+
+    for (i = 0; i < n; i++) {
+        workers.push_back(new Worker());
+    }
+
+    for (i = 0; i < n; i++) {
+        threads.push_back(std::thread(&ThreadPool::run, this, i));
+    }
+}
+
+// Destructor.
+ThreadPool::~ThreadPool() {
+    unsigned int i;
+
+    wait();
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+
+        stopping = true;
+
+        wakeUp.notify_all();
+    }
+
+    for (i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+
+    for (i = 0; i < workers.size(); i++) {
+        delete workers[i];
+    }
+}
+
+} // namespace NLPUCCLIHooke
+
+// vim:set nu et ts=4 sw=4:
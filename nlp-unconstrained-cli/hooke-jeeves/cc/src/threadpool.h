@@ -0,0 +1,153 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/threadpool.h
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#ifndef __CC__THREADPOOL_H
+#define __CC__THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * The <code>NLPUCCLIHooke</code> namespace is used as a container
+ * for the <code>ThreadPool</code> class.
+ */
+namespace NLPUCCLIHooke {
+
+/**
+ * The <code>ThreadPool</code> class is a fixed-size work-stealing
+ * thread pool.
+ * <br />
+ * <br />Each worker owns a task deque: it pops its own tasks LIFO
+ * (from the back) and, when running dry, steals from the front
+ * of the other workers' deques. Tasks get the index of the worker
+ * running them, so that callers can keep per-worker state (e.g. solver
+ * and counter instances) without any locking.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @see     MultiStart
+ * @since   hooke-jeeves 0.1
+ */
+class ThreadPool {
+public:
+    /** The task type. The argument is the index of the running worker. */
+    typedef std::function<void(unsigned int)> Task;
+
+private:
+    /** The per-worker task deque. */
+    struct Worker {
+        /** The lock guarding the deque. */
+        std::mutex mutex;
+
+        /** The tasks queued to this worker. */
+        std::deque<Task> tasks;
+    };
+
+    /** The workers' deques. */
+    std::vector<Worker *> workers;
+
+    /** The worker threads. */
+    std::vector<std::thread> threads;
+
+    /** The lock for sleeping/waking up workers and waiters. */
+    std::mutex lock;
+
+    /** Signalled when new tasks are submitted or on shutdown. */
+    std::condition_variable wakeUp;
+
+    /** Signalled when the last pending task completes. */
+    std::condition_variable allDone;
+
+    /** The number of submitted but not yet completed tasks. */
+    std::atomic<unsigned int> pending;
+
+    /** The number of queued but not yet started tasks. */
+    std::atomic<unsigned int> queued;
+
+    /** The round-robin index of the next deque to submit to. */
+    std::atomic<unsigned int> next;
+
+    /** The shutdown flag. */
+    bool stopping;
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Takes a task: from the own deque first, then steals one.
+     *
+     * @param index The index of the worker.
+     * @param task  The task taken (output).
+     *
+     * @return <code>true</code> if a task has been taken.
+     */
+    bool take(const unsigned int, Task &);
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />The worker thread main loop.
+     *
+     * @param index The index of the worker.
+     */
+    void run(const unsigned int);
+
+public:
+    /**
+     * Getter for the number of worker threads.
+     *
+     * @return The number of worker threads.
+     */
+    unsigned int size() const;
+
+    /**
+     * Submits a task to the pool.
+     *
+     * @param task The task to run.
+     */
+    void submit(const Task &);
+
+    /** Blocks until all the submitted tasks are completed. */
+    void wait();
+
+    /**
+     * Constructor.
+     *
+     * @param nThreads The number of worker threads;
+     *                 0 means one per hardware thread.
+     */
+    explicit ThreadPool(const unsigned int = 0);
+
+    /** Destructor. Completes the queued tasks and joins the workers. */
+    ~ThreadPool();
+};
+
+} // namespace NLPUCCLIHooke
+
+#endif // __CC__THREADPOOL_H
+
+// vim:set nu et ts=4 sw=4:
@@ -0,0 +1,176 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/trace.cc
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <iomanip>
+
+#include "trace.h"
+
+// The NLPUCCLIHooke namespace.
+namespace NLPUCCLIHooke {
+
+// Helper constant (the room for one formatted number).
+const unsigned int TRACE_NUMBER_SIZE = 32;
+
+// Helper function.
+// Formats a value of a JSON record: JSON has no NaN or infinity,
+// so a non-finite value is written as null.
+static void jsonNumber(char *buf, const double v) {
+    if (std::isfinite(v)) {
+        std::snprintf(buf, TRACE_NUMBER_SIZE, "%.17g", v);
+    } else {
+        std::snprintf(buf, TRACE_NUMBER_SIZE, "null");
+    }
+}
+
+// Helper method write(...).
+void Trace::write(const char *event,
+                  const unsigned int iters,
+                  const unsigned long long funEvals,
+                  const double f,
+                  const double *x,
+                  const unsigned int n) {
+
+    char buf[TRACE_NUMBER_SIZE];
+
+    unsigned int i;
+
+    if (format == TRACE_JSONL) {
+        out << "{\"event\":\"" << event << "\",\"iter\":" << iters
+            << ",\"funevals\":" << funEvals;
+
+        jsonNumber(buf, f);
+
+        out << ",\"f\":" << buf << ",\"x\":[";
+
+        for (i = 0; i < n; i++) {
+            jsonNumber(buf, x[i]);
+
+            out << ((i > 0) ? "," : "") << buf;
+        }
+
+        out << "]}\n";
+    } else {
+        if (!headed) {
+            out << "event,iter,funevals,f";
+
+            for (i = 0; i < n; i++) {
+                out << ",x" << i;
+            }
+
+            out << "\n";
+
+            headed = true;
+        }
+
+        std::snprintf(buf, TRACE_NUMBER_SIZE, "%.17g", f);
+
+        out << event << "," << iters << "," << funEvals << "," << buf;
+
+        for (i = 0; i < n; i++) {
+            std::snprintf(buf, TRACE_NUMBER_SIZE, "%.17g", x[i]);
+
+            out << "," << buf;
+        }
+
+        out << "\n";
+    }
+}
+
+// Reports the state at the start of an iteration.
+void Trace::iteration(const unsigned int iters,
+                      const unsigned long long funEvals,
+                      const double f,
+                      const double *x,
+                      const unsigned int n) {
+
+    unsigned int j;
+
+    if (format != TRACE_TEXT) {
+        write("iteration", iters, funEvals, f, x, n);
+
+        return;
+    }
+
+    // Not using here std::endl - see
+    // http://en.cppreference.com/w/cpp/io/manip/endl
+    // for the reason why.
+    out << "\n"
+        << "After " << std::setw(5) << funEvals
+        << " funevals, f(x) =  " << std::setprecision(4)
+        << std::scientific << f << " at\n";
+
+    for (j = 0; j < n; j++) {
+        out << "   x[" << std::setw(2) << j << "] = " << x[j] << "\n";
+    }
+}
+
+// Reports the end of a solve.
+void Trace::summary(const unsigned int iters,
+                    const unsigned long long funEvals,
+                    const double f,
+                    const double *x,
+                    const unsigned int n) {
+
+    // The full text trace stays exactly the legacy one (no summary).
+    if ((level == TRACE_NONE)
+        || ((level == TRACE_FULL) && (format == TRACE_TEXT))) {
+
+        return;
+    }
+
+    if (format != TRACE_TEXT) {
+        write("summary", iters, funEvals, f, x, n);
+
+        return;
+    }
+
+    out << "\n"
+        << "After " << std::setw(5) << funEvals << " funevals and "
+        << iters << " iterations, f(x) =  " << std::setprecision(4)
+        << std::scientific << f << "\n";
+}
+
+// Makes sure all the records reported so far are written.
+void Trace::flush() {
+    out.flush();
+}
+
+// Constructor.
+Trace::Trace(std::ostream &__out,
+             const TraceLevel __level,
+             const TraceFormat __format,
+             const unsigned int __every)
+    : out(__out),
+      level(__level),
+      format(__format),
+      every((__every > 0) ? __every : 1),
+      headed(false) {}
+
+// Destructor.
+Trace::~Trace() {}
+
+} // namespace NLPUCCLIHooke
+
+// vim:set nu et ts=4 sw=4:
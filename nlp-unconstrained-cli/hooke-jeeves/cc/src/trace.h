@@ -0,0 +1,225 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/trace.h
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#ifndef __CC__TRACE_H
+#define __CC__TRACE_H
+
+#include <iostream>
+
+/**
+ * The <code>NLPUCCLIHooke</code> namespace is used as a container
+ * for the <code>Trace</code> class.
+ */
+namespace NLPUCCLIHooke {
+
+/** The amount of the solver progress to report. */
+enum TraceLevel {
+    /** Nothing at all. */
+    TRACE_NONE,
+
+    /** One record, at the end of the solve. */
+    TRACE_SUMMARY,
+
+    /** Every k-th iteration, then the end of the solve. */
+    TRACE_EVERY,
+
+    /** Every iteration (the default). */
+    TRACE_FULL
+};
+
+/** The layout of the trace records. */
+enum TraceFormat {
+    /** The human-readable text (the default). */
+    TRACE_TEXT,
+
+    /** One JSON object per line. */
+    TRACE_JSONL,
+
+    /** Comma-separated values, after a header line. */
+    TRACE_CSV,
+
+    /** Packed fixed-width records (written by <code>BinaryTrace</code>). */
+    TRACE_BINARY
+};
+
+/**
+ * The <code>Trace</code> class reports the progress of a solve:
+ * it decides which iterations get reported and formats their records
+ * (the iteration number, the number of function evaluations so far,
+ * the objective function value and the base point) onto a stream.
+ * <br />
+ * <br />The text records at <code>TRACE_FULL</code> are exactly the ones
+ * the solver has always printed. The JSON-lines and CSV records carry
+ * the values with 17 significant digits, so they read back bit-exact
+ * (JSON has no NaN or infinity: the JSON-lines ones are null there).
+ * <br />
+ * <br />The records are written synchronously; subclasses may queue
+ * them instead (see <code>AsyncTrace</code>) or lay them out
+ * in a binary form (see <code>BinaryTrace</code>).
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @see     Hooke
+ * @see     AsyncTrace
+ * @see     BinaryTrace
+ * @since   hooke-jeeves 0.1
+ */
+class Trace {
+private:
+    /** The stream to write the records to. */
+    std::ostream &out;
+
+    /** The amount of the progress to report. */
+    TraceLevel level;
+
+    /** The layout of the records. */
+    TraceFormat format;
+
+    /** The iteration step of <code>TRACE_EVERY</code>. */
+    unsigned int every;
+
+    /** Whether the CSV header line has been written. */
+    bool headed;
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Writes one record.
+     *
+     * @param event    The record kind (<code>"iteration"</code>
+     *                 or <code>"summary"</code>).
+     * @param iters    The iteration number.
+     * @param funEvals The number of function evaluations so far.
+     * @param f        The objective function value at the point.
+     * @param x        The point.
+     * @param n        The number of coordinates of <code>x</code>.
+     */
+    void write(const char *,
+               const unsigned int,
+               const unsigned long long,
+               const double,
+               const double *,
+               const unsigned int);
+
+protected:
+    /**
+     * Getter for <code>out</code>.
+     *
+     * @return The stream to write the records to.
+     */
+    std::ostream &getOut() const;
+
+    /**
+     * Getter for <code>level</code>.
+     *
+     * @return The amount of the progress to report.
+     */
+    TraceLevel getLevel() const;
+
+public:
+    /**
+     * Tells whether an iteration gets reported.
+     *
+     * @param iters The iteration number (counting from 1).
+     *
+     * @return <code>true</code> if <code>iteration()</code> should
+     *         be called for it.
+     */
+    bool wants(const unsigned int) const;
+
+    /**
+     * Reports the state at the start of an iteration.
+     *
+     * @param iters    The iteration number.
+     * @param funEvals The number of function evaluations so far.
+     * @param f        The objective function value at the base point.
+     * @param x        The base point.
+     * @param n        The number of coordinates of <code>x</code>.
+     */
+    virtual void iteration(const unsigned int,
+                           const unsigned long long,
+                           const double,
+                           const double *,
+                           const unsigned int);
+
+    /**
+     * Reports the end of a solve (at every level but
+     * <code>TRACE_NONE</code>, except for the text records
+     * at <code>TRACE_FULL</code>, which have never had it).
+     *
+     * @param iters    The number of iterations used.
+     * @param funEvals The number of function evaluations used.
+     * @param f        The objective function value at the ending point.
+     * @param x        The ending point.
+     * @param n        The number of coordinates of <code>x</code>.
+     */
+    virtual void summary(const unsigned int,
+                         const unsigned long long,
+                         const double,
+                         const double *,
+                         const unsigned int);
+
+    /**
+     * Makes sure all the records reported so far are written
+     * (the solver calls it at the end of every solve).
+     */
+    virtual void flush();
+
+    /**
+     * Constructor.
+     *
+     * @param __out    The stream to write the records to.
+     * @param __level  The amount of the progress to report.
+     * @param __format The layout of the records.
+     * @param __every  The iteration step of <code>TRACE_EVERY</code>.
+     */
+    explicit Trace(std::ostream & = std::cout,
+                   const TraceLevel = TRACE_FULL,
+                   const TraceFormat = TRACE_TEXT,
+                   const unsigned int = 1);
+
+    /** Destructor. */
+    virtual ~Trace();
+};
+
+// Getter for out.
+inline std::ostream &Trace::getOut() const {
+    return out;
+}
+
+// Getter for level.
+inline TraceLevel Trace::getLevel() const {
+    return level;
+}
+
+// Tells whether an iteration gets reported.
+inline bool Trace::wants(const unsigned int iters) const {
+    return ((level == TRACE_FULL)
+        || ((level == TRACE_EVERY) && ((iters % every) == 0)));
+}
+
+} // namespace NLPUCCLIHooke
+
+#endif // __CC__TRACE_H
+
+// vim:set nu et ts=4 sw=4:
@@ -0,0 +1,202 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/tracedump.cc
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "bintrace.h"
+
+using namespace NLPUCCLIHooke;
+
+/**
+ * Helper function.
+ * <br />
+ * <br />Prints one record in the text layout of the solvers.
+ *
+ * @param r     The fixed part of the record.
+ * @param x     The point.
+ * @param nVars The number of coordinates of <code>x</code>.
+ */
+static void dumpText(const BinTraceRecord &r,
+                     const double *x,
+                     const unsigned int nVars) {
+
+    unsigned int j;
+
+    if (r.event == BIN_TRACE_SUMMARY) {
+        std::printf("\nAfter %5llu funevals and %u iterations, "
+                    "f(x) =  %.4e\n", (unsigned long long) r.funEvals,
+                    (unsigned int) r.iters, r.f);
+
+        return;
+    }
+
+    std::printf("\nAfter %5llu funevals, f(x) =  %.4e at\n",
+                (unsigned long long) r.funEvals, r.f);
+
+    for (j = 0; j < nVars; j++) {
+        std::printf("   x[%2u] = %.4e\n", j, x[j]);
+    }
+}
+
+/**
+ * Helper function.
+ * <br />
+ * <br />Prints one record as a CSV line (the values read back bit-exact).
+ *
+ * @param r     The fixed part of the record.
+ * @param x     The point.
+ * @param nVars The number of coordinates of <code>x</code>.
+ */
+static void dumpCsv(const BinTraceRecord &r,
+                    const double *x,
+                    const unsigned int nVars) {
+
+    unsigned int j;
+
+    std::printf("%s,%u,%llu,%.17g",
+                (r.event == BIN_TRACE_SUMMARY) ? "summary" : "iteration",
+                (unsigned int) r.iters, (unsigned long long) r.funEvals,
+                r.f);
+
+    for (j = 0; j < nVars; j++) {
+        std::printf(",%.17g", x[j]);
+    }
+
+    std::printf("\n");
+}
+
+// Main program function main() :-).
+int main(int argc, char **argv) {
+    int         fd;
+    struct stat st;
+    const char *path = NULL;
+    bool        csv  = false;
+    int         arg;
+
+    unsigned int j;
+
+    BinTraceHeader h;
+    BinTraceRecord r;
+
+    const char *data;
+    std::size_t offset;
+    std::vector<double> x;
+
+    for (arg = 1; arg < argc; arg++) {
+        if (std::strcmp(argv[arg], "--csv") == 0) {
+            csv = true;
+        } else if ((path == NULL) && (argv[arg][0] != '-')) {
+            path = argv[arg];
+        } else {
+            path = NULL;
+
+            break;
+        }
+    }
+
+    if (path == NULL) {
+        std::fprintf(stderr, "Usage: %s [--csv] FILE\n", argv[0]);
+
+        return EXIT_FAILURE;
+    }
+
+    // The whole file gets mapped: the records are read in place.
+    if (((fd = open(path, O_RDONLY)) < 0) || (fstat(fd, &st) != 0)) {
+        std::fprintf(stderr, "%s: cannot open %s\n", argv[0], path);
+
+        return EXIT_FAILURE;
+    }
+
+    if ((std::size_t) st.st_size < sizeof(h)) {
+        std::fprintf(stderr, "%s: %s: not a binary trace\n", argv[0], path);
+
+        close(fd);
+
+        return EXIT_FAILURE;
+    }
+
+    data = (const char *) mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE,
+                               fd, 0);
+
+    close(fd);
+
+    if (data == MAP_FAILED) {
+        std::fprintf(stderr, "%s: cannot map %s\n", argv[0], path);
+
+        return EXIT_FAILURE;
+    }
+
+    std::memcpy(&h, data, sizeof(h));
+
+    if ((std::memcmp(h.magic, BIN_TRACE_MAGIC, BIN_TRACE_MAGIC_SIZE) != 0)
+        || (h.version != BIN_TRACE_VERSION)
+        || (h.recordSize != sizeof(r) + h.nVars * sizeof(double))) {
+
+        std::fprintf(stderr, "%s: %s: not a binary trace (of version %u)\n",
+                     argv[0], path, (unsigned int) BIN_TRACE_VERSION);
+
+        munmap((void *) data, st.st_size);
+
+        return EXIT_FAILURE;
+    }
+
+    if (csv) {
+        std::printf("event,iter,funevals,f");
+
+        for (j = 0; j < h.nVars; j++) {
+            std::printf(",x%u", j);
+        }
+
+        std::printf("\n");
+    }
+
+    x.resize(h.nVars + 1);
+
+    // A truncated trailing record (of a killed solver) is skipped.
+    for (offset = sizeof(h); offset + h.recordSize <= (std::size_t)
+         st.st_size; offset += h.recordSize) {
+
+        std::memcpy(&r, data + offset, sizeof(r));
+        std::memcpy(&x[0], data + offset + sizeof(r),
+                    h.nVars * sizeof(double));
+
+        if (csv) {
+            dumpCsv(r, &x[0], h.nVars);
+        } else {
+            dumpText(r, &x[0], h.nVars);
+        }
+    }
+
+    munmap((void *) data, st.st_size);
+
+    return EXIT_SUCCESS;
+}
+
+// vim:set nu et ts=4 sw=4:
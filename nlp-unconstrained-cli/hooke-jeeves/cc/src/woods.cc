@@ -22,45 +22,430 @@
  */
 
 #include "woods.h"
-#include "funevals.h"
+
+#ifdef OBJECTIVE_X86_KERNELS
+    #include <immintrin.h>
+#endif
 
 // The NLPUCCLIHooke namespace.
 namespace NLPUCCLIHooke {
 
-// Helper constants.
-const unsigned int ONE_HUNDRED = 100;
-const unsigned int NINETY      = 90;
-const unsigned int TEN         = 10;
-const double       TEN_POINT   = 10.;
-
-// The user-supplied objective function f(x,n).
-double Woods::f(const double *x, const unsigned int n, const void *cFunEvals) {
-    double s1;
-    double s2;
-    double s3;
-    double t1;
-    double t2;
-    double t3;
-    double t4;
-    double t5;
-
-    ((FunEvals *) cFunEvals)->setFunEvals(
-    ((FunEvals *) cFunEvals)->getFunEvals() + 1);
-
-    s1 = x[INDEX_ONE]   - x[INDEX_ZERO] * x[INDEX_ZERO];
-    s2 = 1              - x[INDEX_ZERO];
-    s3 = x[INDEX_ONE]   - 1;
-
-    t1 = x[INDEX_THREE] - x[INDEX_TWO]  * x[INDEX_TWO];
-    t2 = 1              - x[INDEX_TWO];
-    t3 = x[INDEX_THREE] - 1;
-
-    t4 = s3 + t3;
-    t5 = s3 - t3;
-
-    return (ONE_HUNDRED * (s1 * s1) + s2 * s2
-               + NINETY * (t1 * t1) + t2 * t2
-                  + TEN * (t4 * t4) + t5 * t5 / TEN_POINT);
+#ifdef OBJECTIVE_X86_KERNELS
+// Helper constants (the number of points per AVX2 and AVX-512 vector).
+const unsigned int AVX2_POINTS   = 4;
+const unsigned int AVX512_POINTS = 8;
+#endif
+
+// The batch kernel: scalar.
+void Woods::batchScalar(const double *x,
+                        const unsigned int n,
+                        const unsigned int m,
+                        const unsigned int k,
+                        double *f) {
+
+    double s;
+    double y[NVARS];
+
+    unsigned int j;
+    unsigned int l;
+    unsigned int p;
+
+    for (p = k; p < m; p++) {
+        s = 0.0;
+
+        for (j = 0; j + INDEX_THREE < n; j += NVARS) {
+            for (l = 0; l < NVARS; l++) {
+                y[l] = x[(std::size_t) (j + l) * m + p];
+            }
+
+            s += block(y);
+        }
+
+        f[p] = s;
+    }
+}
+
+#ifdef OBJECTIVE_X86_KERNELS
+// The batch kernel: AVX2, the same operations as block() does.
+__attribute__((target("avx2")))
+void Woods::batchAvx2(const double *x,
+                      const unsigned int n,
+                      const unsigned int m,
+                      const unsigned int k,
+                      double *f) {
+
+    const __m256d hundred = _mm256_set1_pd(ONE_HUNDRED);
+    const __m256d ninety  = _mm256_set1_pd(NINETY);
+    const __m256d ten     = _mm256_set1_pd(TEN);
+    const __m256d tenPt   = _mm256_set1_pd(TEN_POINT);
+    const __m256d one     = _mm256_set1_pd(1);
+
+    __m256d s;
+    __m256d x0;
+    __m256d x1;
+    __m256d x2;
+    __m256d x3;
+    __m256d s1;
+    __m256d s2;
+    __m256d s3;
+    __m256d t1;
+    __m256d t2;
+    __m256d t3;
+    __m256d t4;
+    __m256d t5;
+    __m256d b;
+
+    std::size_t  i;
+    unsigned int j;
+    unsigned int p;
+
+    for (p = k; p + AVX2_POINTS <= m; p += AVX2_POINTS) {
+        s = _mm256_setzero_pd();
+
+        for (j = 0; j + INDEX_THREE < n; j += NVARS) {
+            i = (std::size_t) j * m + p;
+
+            x0 = _mm256_loadu_pd(x + i);
+            x1 = _mm256_loadu_pd(x + i + m);
+            x2 = _mm256_loadu_pd(x + i + 2 * (std::size_t) m);
+            x3 = _mm256_loadu_pd(x + i + 3 * (std::size_t) m);
+
+            s1 = _mm256_sub_pd(x1,  _mm256_mul_pd(x0, x0));
+            s2 = _mm256_sub_pd(one, x0);
+            s3 = _mm256_sub_pd(x1,  one);
+
+            t1 = _mm256_sub_pd(x3,  _mm256_mul_pd(x2, x2));
+            t2 = _mm256_sub_pd(one, x2);
+            t3 = _mm256_sub_pd(x3,  one);
+
+            t4 = _mm256_add_pd(s3, t3);
+            t5 = _mm256_sub_pd(s3, t3);
+
+            b = _mm256_mul_pd(hundred, _mm256_mul_pd(s1, s1));
+            b = _mm256_add_pd(b, _mm256_mul_pd(s2, s2));
+            b = _mm256_add_pd(b, _mm256_mul_pd(ninety, _mm256_mul_pd(t1, t1)));
+            b = _mm256_add_pd(b, _mm256_mul_pd(t2, t2));
+            b = _mm256_add_pd(b, _mm256_mul_pd(ten, _mm256_mul_pd(t4, t4)));
+            b = _mm256_add_pd(b, _mm256_div_pd(_mm256_mul_pd(t5, t5), tenPt));
+
+            s = _mm256_add_pd(s, b);
+        }
+
+        _mm256_storeu_pd(f + p, s);
+    }
+
+    batchScalar(x, n, m, p, f);
+}
+
+// The batch kernel: AVX-512, the same operations as block() does.
+__attribute__((target("avx512f")))
+void Woods::batchAvx512(const double *x,
+                        const unsigned int n,
+                        const unsigned int m,
+                        const unsigned int k,
+                        double *f) {
+
+    const __m512d hundred = _mm512_set1_pd(ONE_HUNDRED);
+    const __m512d ninety  = _mm512_set1_pd(NINETY);
+    const __m512d ten     = _mm512_set1_pd(TEN);
+    const __m512d tenPt   = _mm512_set1_pd(TEN_POINT);
+    const __m512d one     = _mm512_set1_pd(1);
+
+    __m512d s;
+    __m512d x0;
+    __m512d x1;
+    __m512d x2;
+    __m512d x3;
+    __m512d s1;
+    __m512d s2;
+    __m512d s3;
+    __m512d t1;
+    __m512d t2;
+    __m512d t3;
+    __m512d t4;
+    __m512d t5;
+    __m512d b;
+
+    std::size_t  i;
+    unsigned int j;
+    unsigned int p;
+
+    for (p = k; p + AVX512_POINTS <= m; p += AVX512_POINTS) {
+        s = _mm512_setzero_pd();
+
+        for (j = 0; j + INDEX_THREE < n; j += NVARS) {
+            i = (std::size_t) j * m + p;
+
+            x0 = _mm512_loadu_pd(x + i);
+            x1 = _mm512_loadu_pd(x + i + m);
+            x2 = _mm512_loadu_pd(x + i + 2 * (std::size_t) m);
+            x3 = _mm512_loadu_pd(x + i + 3 * (std::size_t) m);
+
+            s1 = _mm512_sub_pd(x1,  _mm512_mul_pd(x0, x0));
+            s2 = _mm512_sub_pd(one, x0);
+            s3 = _mm512_sub_pd(x1,  one);
+
+            t1 = _mm512_sub_pd(x3,  _mm512_mul_pd(x2, x2));
+            t2 = _mm512_sub_pd(one, x2);
+            t3 = _mm512_sub_pd(x3,  one);
+
+            t4 = _mm512_add_pd(s3, t3);
+            t5 = _mm512_sub_pd(s3, t3);
+
+            b = _mm512_mul_pd(hundred, _mm512_mul_pd(s1, s1));
+            b = _mm512_add_pd(b, _mm512_mul_pd(s2, s2));
+            b = _mm512_add_pd(b, _mm512_mul_pd(ninety, _mm512_mul_pd(t1, t1)));
+            b = _mm512_add_pd(b, _mm512_mul_pd(t2, t2));
+            b = _mm512_add_pd(b, _mm512_mul_pd(ten, _mm512_mul_pd(t4, t4)));
+            b = _mm512_add_pd(b, _mm512_div_pd(_mm512_mul_pd(t5, t5), tenPt));
+
+            s = _mm512_add_pd(s, b);
+        }
+
+        _mm512_storeu_pd(f + p, s);
+    }
+
+    batchAvx2(x, n, m, p, f);
+}
+#endif
+
+// The batch objective function.
+void Woods::fBatch(const double *x,
+                   const unsigned int n,
+                   const unsigned int m,
+                   double *f,
+                   FunEvals *funEvals) {
+
+    typedef void (*Kernel)(const double *,
+                           const unsigned int,
+                           const unsigned int,
+                           const unsigned int,
+                           double *);
+
+    // Picking the kernel once, on the first call.
+#ifdef OBJECTIVE_X86_KERNELS
+    static const Kernel kernel
+        = __builtin_cpu_supports("avx512f") ? &batchAvx512
+        : __builtin_cpu_supports("avx2")    ? &batchAvx2
+        :                                     &batchScalar;
+#else
+    static const Kernel kernel = &batchScalar;
+#endif
+
+    funEvals->add(FUN_EVALS, m);
+
+    kernel(x, n, m, 0, f);
+}
+
+// The single-point kernel: scalar.
+double Woods::sumScalar(const double *x,
+                        const unsigned int n,
+                        const unsigned int k,
+                        const double s) {
+
+    double sum = s;
+
+    unsigned int j;
+
+    for (j = k; j + INDEX_THREE < n; j += NVARS) {
+        sum += block(x + j);
+    }
+
+    return sum;
+}
+
+#ifdef OBJECTIVE_X86_KERNELS
+// The single-point kernel: AVX2, the same operations as block() does.
+__attribute__((target("avx2")))
+double Woods::sumAvx2(const double *x,
+                      const unsigned int n,
+                      const unsigned int k,
+                      const double s) {
+
+    const __m256d hundred = _mm256_set1_pd(ONE_HUNDRED);
+    const __m256d ninety  = _mm256_set1_pd(NINETY);
+    const __m256d ten     = _mm256_set1_pd(TEN);
+    const __m256d tenPt   = _mm256_set1_pd(TEN_POINT);
+    const __m256d one     = _mm256_set1_pd(1);
+
+    __m256d r0;
+    __m256d r1;
+    __m256d r2;
+    __m256d r3;
+    __m256d x0;
+    __m256d x1;
+    __m256d x2;
+    __m256d x3;
+    __m256d s1;
+    __m256d s2;
+    __m256d s3;
+    __m256d t1;
+    __m256d t2;
+    __m256d t3;
+    __m256d t4;
+    __m256d t5;
+    __m256d b;
+
+    double sum = s;
+    double t[AVX2_POINTS];
+
+    unsigned int j;
+    unsigned int l;
+
+    // Four blocks at a time, transposed so that a vector holds
+    // the same coordinate of all of them.
+    for (j = k; j + NVARS * AVX2_POINTS <= n; j += NVARS * AVX2_POINTS) {
+        r0 = _mm256_loadu_pd(x + j);
+        r1 = _mm256_loadu_pd(x + j + NVARS);
+        r2 = _mm256_loadu_pd(x + j + 2 * NVARS);
+        r3 = _mm256_loadu_pd(x + j + 3 * NVARS);
+
+        t1 = _mm256_unpacklo_pd(r0, r1);
+        t2 = _mm256_unpackhi_pd(r0, r1);
+        t3 = _mm256_unpacklo_pd(r2, r3);
+        t4 = _mm256_unpackhi_pd(r2, r3);
+
+        x0 = _mm256_permute2f128_pd(t1, t3, 0x20);
+        x1 = _mm256_permute2f128_pd(t2, t4, 0x20);
+        x2 = _mm256_permute2f128_pd(t1, t3, 0x31);
+        x3 = _mm256_permute2f128_pd(t2, t4, 0x31);
+
+        s1 = _mm256_sub_pd(x1,  _mm256_mul_pd(x0, x0));
+        s2 = _mm256_sub_pd(one, x0);
+        s3 = _mm256_sub_pd(x1,  one);
+
+        t1 = _mm256_sub_pd(x3,  _mm256_mul_pd(x2, x2));
+        t2 = _mm256_sub_pd(one, x2);
+        t3 = _mm256_sub_pd(x3,  one);
+
+        t4 = _mm256_add_pd(s3, t3);
+        t5 = _mm256_sub_pd(s3, t3);
+
+        b = _mm256_mul_pd(hundred, _mm256_mul_pd(s1, s1));
+        b = _mm256_add_pd(b, _mm256_mul_pd(s2, s2));
+        b = _mm256_add_pd(b, _mm256_mul_pd(ninety, _mm256_mul_pd(t1, t1)));
+        b = _mm256_add_pd(b, _mm256_mul_pd(t2, t2));
+        b = _mm256_add_pd(b, _mm256_mul_pd(ten, _mm256_mul_pd(t4, t4)));
+        b = _mm256_add_pd(b, _mm256_div_pd(_mm256_mul_pd(t5, t5), tenPt));
+
+        _mm256_storeu_pd(t, b);
+
+        for (l = 0; l < AVX2_POINTS; l++) {
+            sum += t[l];
+        }
+    }
+
+    return sumScalar(x, n, j, sum);
+}
+
+// The single-point kernel: AVX-512, the same operations as block() does.
+__attribute__((target("avx512f")))
+double Woods::sumAvx512(const double *x,
+                        const unsigned int n,
+                        const unsigned int k,
+                        const double s) {
+
+    const __m512d hundred = _mm512_set1_pd(ONE_HUNDRED);
+    const __m512d ninety  = _mm512_set1_pd(NINETY);
+    const __m512d ten     = _mm512_set1_pd(TEN);
+    const __m512d tenPt   = _mm512_set1_pd(TEN_POINT);
+    const __m512d one     = _mm512_set1_pd(1);
+    const __m512d zero    = _mm512_setzero_pd();
+
+    const __mmask8 lanes = 0xFF;
+
+    // The first coordinates of eight consecutive blocks.
+    const __m512i blocks = _mm512_set_epi64(7 * NVARS, 6 * NVARS,
+                                            5 * NVARS, 4 * NVARS,
+                                            3 * NVARS, 2 * NVARS,
+                                                NVARS,         0);
+
+    __m512d x0;
+    __m512d x1;
+    __m512d x2;
+    __m512d x3;
+    __m512d s1;
+    __m512d s2;
+    __m512d s3;
+    __m512d t1;
+    __m512d t2;
+    __m512d t3;
+    __m512d t4;
+    __m512d t5;
+    __m512d b;
+
+    double sum = s;
+    double t[AVX512_POINTS];
+
+    unsigned int j;
+    unsigned int l;
+
+    for (j = k; j + NVARS * AVX512_POINTS <= n;
+         j += NVARS * AVX512_POINTS) {
+
+        // Masked gathers (all lanes): the unmasked ones leave GCC
+        // complaining about their uninitialized pass-through operand.
+        x0 = _mm512_mask_i64gather_pd(zero, lanes, blocks, x + j,
+                                      sizeof(double));
+        x1 = _mm512_mask_i64gather_pd(zero, lanes, blocks, x + j + INDEX_ONE,
+                                      sizeof(double));
+        x2 = _mm512_mask_i64gather_pd(zero, lanes, blocks, x + j + INDEX_TWO,
+                                      sizeof(double));
+        x3 = _mm512_mask_i64gather_pd(zero, lanes, blocks,
+                                      x + j + INDEX_THREE, sizeof(double));
+
+        s1 = _mm512_sub_pd(x1,  _mm512_mul_pd(x0, x0));
+        s2 = _mm512_sub_pd(one, x0);
+        s3 = _mm512_sub_pd(x1,  one);
+
+        t1 = _mm512_sub_pd(x3,  _mm512_mul_pd(x2, x2));
+        t2 = _mm512_sub_pd(one, x2);
+        t3 = _mm512_sub_pd(x3,  one);
+
+        t4 = _mm512_add_pd(s3, t3);
+        t5 = _mm512_sub_pd(s3, t3);
+
+        b = _mm512_mul_pd(hundred, _mm512_mul_pd(s1, s1));
+        b = _mm512_add_pd(b, _mm512_mul_pd(s2, s2));
+        b = _mm512_add_pd(b, _mm512_mul_pd(ninety, _mm512_mul_pd(t1, t1)));
+        b = _mm512_add_pd(b, _mm512_mul_pd(t2, t2));
+        b = _mm512_add_pd(b, _mm512_mul_pd(ten, _mm512_mul_pd(t4, t4)));
+        b = _mm512_add_pd(b, _mm512_div_pd(_mm512_mul_pd(t5, t5), tenPt));
+
+        _mm512_storeu_pd(t, b);
+
+        for (l = 0; l < AVX512_POINTS; l++) {
+            sum += t[l];
+        }
+    }
+
+    return sumAvx2(x, n, j, sum);
+}
+#endif
+
+// The vector objective function.
+double Woods::fVector(const double *x,
+                      const unsigned int n,
+                      FunEvals *funEvals) {
+
+    typedef double (*Kernel)(const double *,
+                             const unsigned int,
+                             const unsigned int,
+                             const double);
+
+    // Picking the kernel once, on the first call.
+#ifdef OBJECTIVE_X86_KERNELS
+    static const Kernel kernel
+        = __builtin_cpu_supports("avx512f") ? &sumAvx512
+        : __builtin_cpu_supports("avx2")    ? &sumAvx2
+        :                                     &sumScalar;
+#else
+    static const Kernel kernel = &sumScalar;
+#endif
+
+    funEvals->add(FUN_EVALS);
+
+    return kernel(x, n, 0, 0.0);
 }
 
 // Default constructor.
@@ -33,17 +33,18 @@
 namespace NLPUCCLIHooke {
 
 /** Helper constants. */
-extern const unsigned int ONE_HUNDRED;
-extern const unsigned int NINETY;
-extern const unsigned int TEN;
-extern const double       TEN_POINT;
+const unsigned int ONE_HUNDRED = 100;
+const unsigned int NINETY      = 90;
+const unsigned int TEN         = 10;
+const double       TEN_POINT   = 10.;
 
 /**
  * The <code>Woods</code> class is responsible for solving a nonlinear
  * optimization problem using the algorithm of Hooke and Jeeves.
  * <br />
  * <br />The objective function in this case
- * is the so-called &quot;Woods&quot; function.
+ * is the so-called &quot;Woods&quot; function, block-extended
+ * to n variables; for n = 4 it is exactly the classic one.
  *
  * @author  Radislav (Radicchio) Golubtsov
  * @version 0.1.1
@@ -51,21 +52,204 @@ extern const double       TEN_POINT;
  * @since   hooke-jeeves 0.1
  */
 class Woods {
+private:
+    /**
+     * Helper method.
+     * <br />
+     * <br />One block of the extended sum: the classic function
+     * of four consecutive coordinates.
+     *
+     * @param x The first of the four coordinates.
+     *
+     * @return The value of the block.
+     */
+    static double block(const double *);
+
+    /**
+     * Helper methods.
+     * <br />
+     * <br />The batch kernels (see <code>fBatch()</code>): each of them
+     * evaluates the points from <code>k</code> on.
+     *
+     * @param x The points (coordinate i of point k at x[i * m + k]).
+     * @param n The number of coordinates of a point.
+     * @param m The number of points.
+     * @param k The first point to evaluate.
+     * @param f The objective function values (output, m).
+     */
+    static void batchScalar(const double *,
+                            const unsigned int,
+                            const unsigned int,
+                            const unsigned int,
+                            double *);
+
+#ifdef OBJECTIVE_X86_KERNELS
+    static void batchAvx2(const double *,
+                          const unsigned int,
+                          const unsigned int,
+                          const unsigned int,
+                          double *);
+
+    static void batchAvx512(const double *,
+                            const unsigned int,
+                            const unsigned int,
+                            const unsigned int,
+                            double *);
+#endif
+
+    /**
+     * Helper methods.
+     * <br />
+     * <br />The single-point kernels (see <code>fVector()</code>): each
+     * of them adds the blocks from the one at <code>k</code> on
+     * to the sum, in order.
+     *
+     * @param x The point.
+     * @param n The number of coordinates of <code>x</code>.
+     * @param k The first coordinate of the first block to add.
+     * @param s The sum of the blocks before it.
+     *
+     * @return The sum of all the blocks.
+     */
+    static double sumScalar(const double *,
+                            const unsigned int,
+                            const unsigned int,
+                            const double);
+
+#ifdef OBJECTIVE_X86_KERNELS
+    static double sumAvx2(const double *,
+                          const unsigned int,
+                          const unsigned int,
+                          const double);
+
+    static double sumAvx512(const double *,
+                            const unsigned int,
+                            const unsigned int,
+                            const double);
+#endif
+
 public:
+    /** Constant. The number of variables of the test problem. */
+    static const unsigned int NVARS = 4;
+
     /**
      * The user-supplied objective function f(x,n).
      * <br />
      * <br />Woods &ndash; a la More, Garbow &amp; Hillstrom
-     * (TOMS algorithm 566).
+     * (TOMS algorithm 566), summed over the n / 4 consecutive blocks
+     * of four coordinates (the trailing n % 4 ones do not enter it).
+     * <br />
+     * <br />A point of <code>VECTOR_MIN_VARS</code> coordinates or more
+     * goes to <code>fVector()</code>, a shorter one
+     * to <code>fScalar()</code>.
      *
      * @param x         The point at which f(x) should be evaluated.
      * @param n         The number of coordinates of <code>x</code>.
-     * @param cFunEvals The number of function evaluations container
-     *                  (FunEvals *).
+     * @param funEvals  The number of function evaluations counter.
      *
      * @return The objective function value.
      */
-    static double f(const double *, const unsigned int, const void *);
+    static double f(const double *, const unsigned int, FunEvals *);
+
+    /**
+     * The scalar objective function: f(x,n), one block after another.
+     *
+     * @param x         The point at which f(x) should be evaluated.
+     * @param n         The number of coordinates of <code>x</code>.
+     * @param funEvals  The number of function evaluations counter.
+     *
+     * @return The objective function value.
+     */
+    static double fScalar(const double *, const unsigned int, FunEvals *);
+
+    /**
+     * The vector objective function: f(x,n), four (AVX2) or eight
+     * (AVX-512) blocks at a time.
+     * <br />
+     * <br />The kernel is picked at runtime, once, as for
+     * <code>fBatch()</code>. The blocks are computed with the same
+     * operations as <code>fScalar()</code> does, then added up one
+     * after another, in the same order, so the value is bit-for-bit
+     * the scalar one: the gain is in the arithmetic of the blocks,
+     * not in the (serial) sum.
+     *
+     * @param x         The point at which f(x) should be evaluated.
+     * @param n         The number of coordinates of <code>x</code>.
+     * @param funEvals  The number of function evaluations counter.
+     *
+     * @return The objective function value.
+     */
+    static double fVector(const double *, const unsigned int, FunEvals *);
+
+    /**
+     * The incremental objective function.
+     * <br />
+     * <br />Updates f(x) after a change of the single coordinate
+     * <code>x[i]</code>, touching only the block it belongs to.
+     *
+     * @param x         The point after the change
+     *                  (<code>x[i] == xNew</code>).
+     * @param n         The number of coordinates of <code>x</code>.
+     * @param fPrev     The objective function value before the change.
+     * @param i         The index of the changed coordinate.
+     * @param xOld      The old value of <code>x[i]</code>.
+     * @param xNew      The new value of <code>x[i]</code>.
+     * @param funEvals  The number of function evaluations counter.
+     *
+     * @return The objective function value after the change.
+     */
+    static double fDelta(const double *,
+                         const unsigned int,
+                         const double,
+                         const unsigned int,
+                         const double,
+                         const double,
+                         FunEvals *);
+
+    /**
+     * The early-abort objective function.
+     * <br />
+     * <br />Sums the blocks in the same order as <code>f()</code> does,
+     * but gives up as soon as the partial sum reaches the threshold:
+     * the blocks are nonnegative, so the full sum cannot get below it.
+     *
+     * @param x         The point at which f(x) should be evaluated.
+     * @param n         The number of coordinates of <code>x</code>.
+     * @param threshold The abort threshold.
+     * @param rejected  Whether the evaluation has been abandoned (output).
+     * @param funEvals  The number of function evaluations counter.
+     *
+     * @return The objective function value, or the partial sum
+     *         if rejected.
+     */
+    static double fBounded(const double *,
+                           const unsigned int,
+                           const double,
+                           bool *,
+                           FunEvals *);
+
+    /**
+     * The batch objective function.
+     * <br />
+     * <br />Evaluates f(x) at m points laid out as structure-of-arrays,
+     * four (AVX2) or eight (AVX-512) points per vector.
+     * The kernel is picked at runtime, once: AVX-512, AVX2,
+     * or the scalar one, whichever the CPU supports. The values are
+     * bit-for-bit those of <code>f()</code> (the kernels do the same
+     * operations in the same order, with no fused multiply-adds).
+     *
+     * @param x         The points (coordinate i of point k
+     *                  at <code>x[i * m + k]</code>).
+     * @param n         The number of coordinates of a point.
+     * @param m         The number of points.
+     * @param f         The objective function values (output, m).
+     * @param funEvals  The number of function evaluations counter.
+     */
+    static void fBatch(const double *,
+                       const unsigned int,
+                       const unsigned int,
+                       double *,
+                       FunEvals *);
 
     /** Default constructor. */
     Woods();
@@ -74,6 +258,127 @@ public:
     ~Woods();
 };
 
+// Helper method block(...).
+inline double Woods::block(const double *x) {
+    double s1;
+    double s2;
+    double s3;
+    double t1;
+    double t2;
+    double t3;
+    double t4;
+    double t5;
+
+    s1 = x[INDEX_ONE]   - x[INDEX_ZERO] * x[INDEX_ZERO];
+    s2 = 1              - x[INDEX_ZERO];
+    s3 = x[INDEX_ONE]   - 1;
+
+    t1 = x[INDEX_THREE] - x[INDEX_TWO]  * x[INDEX_TWO];
+    t2 = 1              - x[INDEX_TWO];
+    t3 = x[INDEX_THREE] - 1;
+
+    t4 = s3 + t3;
+    t5 = s3 - t3;
+
+    return (ONE_HUNDRED * (s1 * s1) + s2 * s2
+               + NINETY * (t1 * t1) + t2 * t2
+                  + TEN * (t4 * t4) + t5 * t5 / TEN_POINT);
+}
+
+/*
+ * The user-supplied objective function f(x,n).
+ * Defined inline, so that the engine could fold it into its exploratory loop
+ * (for a fixed number of variables, the choice of the kernel folds away).
+ */
+inline double Woods::f(const double *x,
+                       const unsigned int n,
+                       FunEvals *funEvals) {
+
+    if (n >= VECTOR_MIN_VARS) {
+        return fVector(x, n, funEvals);
+    }
+
+    return fScalar(x, n, funEvals);
+}
+
+// The scalar objective function.
+inline double Woods::fScalar(const double *x,
+                             const unsigned int n,
+                             FunEvals *funEvals) {
+
+    double s = 0.0;
+
+    unsigned int k;
+
+    funEvals->add(FUN_EVALS);
+
+    for (k = 0; k + INDEX_THREE < n; k += NVARS) {
+        s += block(x + k);
+    }
+
+    return s;
+}
+
+// The incremental objective function.
+inline double Woods::fDelta(const double *x,
+                            const unsigned int n,
+                            const double fPrev,
+                            const unsigned int i,
+                            const double xOld,
+                            const double xNew,
+                            FunEvals *funEvals) {
+
+    double y[NVARS];
+
+    unsigned int j;
+    unsigned int k = i - (i % NVARS);
+
+    funEvals->add(FUN_EVALS);
+
+    // A trailing coordinate does not enter the function at all.
+    if (k + INDEX_THREE >= n) {
+        return fPrev;
+    }
+
+    for (j = 0; j < NVARS; j++) {
+        y[j] = x[k + j];
+    }
+
+    y[i - k] = xOld;
+
+    return (fPrev + (block(x + k) - block(y)));
+}
+
+// The early-abort objective function.
+inline double Woods::fBounded(const double *x,
+                              const unsigned int n,
+                              const double threshold,
+                              bool *rejected,
+                              FunEvals *funEvals) {
+
+    double s = 0.0;
+
+    unsigned int k;
+
+    for (k = 0; k + INDEX_THREE < n; k += NVARS) {
+        s += block(x + k);
+
+        if (s >= threshold) {
+            *rejected = true;
+
+            funEvals->add(REJECTED_EVALS);
+
+            return s;
+        }
+    }
+
+    *rejected = false;
+
+    funEvals->add(FUN_EVALS);
+
+    return s;
+}
+
 } // namespace NLPUCCLIHooke
 
 #endif // __CC__WOODS_H
@@ -0,0 +1,93 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/workspace.cc
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include "workspace.h"
+
+// The NLPUCCLIHooke namespace.
+namespace NLPUCCLIHooke {
+
+// Helper constants (the number of nVars-wide double arrays, sans lanes).
+const std::size_t WORKSPACE_ARRAYS = 7;
+
+// Helper method.
+// Rounds a size in bytes up to a whole number of aligned blocks.
+static std::size_t aligned(const std::size_t size) {
+    return ((size + WORKSPACE_ALIGN - 1) / WORKSPACE_ALIGN) * WORKSPACE_ALIGN;
+}
+
+// Helper method carve(...).
+void *Workspace::carve(const std::size_t size) {
+    char *array = top;
+
+    top += aligned(size);
+
+    return array;
+}
+
+// Constructor.
+Workspace::Workspace(const unsigned int __nVars, const unsigned int __nLanes)
+    : nVars(__nVars),
+      nLanes((__nLanes == 0) ? 1 : __nLanes),
+      row(aligned(__nVars * sizeof(double)) / sizeof(double)),
+      arena(NULL) {
+
+    std::size_t size = (WORKSPACE_ARRAYS + nLanes) * row * sizeof(double)
+                     + aligned(nVars * sizeof(unsigned int))
+                     + aligned(nVars * sizeof(unsigned char));
+
+    // An empty workspace still gets a (minimal) block of its own.
+    if (size == 0) {
+        size = WORKSPACE_ALIGN;
+    }
+
+    if (posix_memalign(&arena, WORKSPACE_ALIGN, size) != 0) {
+        throw std::bad_alloc();
+    }
+
+    top = (char *) arena;
+
+    newX    = (double *) carve(nVars * sizeof(double));
+    xBefore = (double *) carve(nVars * sizeof(double));
+    delta   = (double *) carve(nVars * sizeof(double));
+    z       = (double *) carve(nVars * sizeof(double));
+    zMinus  = (double *) carve(nVars * sizeof(double));
+    fPoll   = (double *) carve(2 * (std::size_t) nVars * sizeof(double));
+    zLanes  = (double *) carve(nLanes * row * sizeof(double));
+    moved   = (unsigned int *) carve(nVars * sizeof(unsigned int));
+    marks   = (unsigned char *) carve(nVars * sizeof(unsigned char));
+
+    std::memset(marks, 0, nVars * sizeof(unsigned char));
+}
+
+// Destructor.
+Workspace::~Workspace() {
+    std::free(arena);
+}
+
+} // namespace NLPUCCLIHooke
+
+// vim:set nu et ts=4 sw=4:
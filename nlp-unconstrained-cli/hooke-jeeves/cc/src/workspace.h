@@ -0,0 +1,262 @@
+/*
+ * nlp-unconstrained-cli/hooke-jeeves/cc/src/workspace.h
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Hooke and Jeeves nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#ifndef __CC__WORKSPACE_H
+#define __CC__WORKSPACE_H
+
+#include <cstddef>
+
+
+/**
+ * The <code>NLPUCCLIHooke</code> namespace is used as a container
+ * for the <code>Workspace</code> class.
+ */
+namespace NLPUCCLIHooke {
+
+/** Constant. The alignment of the work arrays (a cache line), in bytes. */
+const unsigned int WORKSPACE_ALIGN = 64;
+
+/**
+ * The <code>Workspace</code> class holds the work arrays of the solver.
+ * <br />
+ * <br />All the arrays are carved out of one arena block, allocated once,
+ * at construction; each of them starts on a cache line boundary.
+ * A workspace sized for <code>nVars</code> variables and
+ * <code>nLanes</code> concurrent poll workers can be reused
+ * by any number of solves that fit it, so that nothing gets allocated
+ * per solve, let alone inside the iteration loop.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @see     Hooke
+ * @since   hooke-jeeves 0.1
+ */
+class Workspace {
+private:
+    /** The number of variables the arrays are sized for. */
+    unsigned int nVars;
+
+    /** The number of concurrent poll workers the arrays are sized for. */
+    unsigned int nLanes;
+
+    /** The aligned length of an nVars-wide array, in doubles. */
+    std::size_t row;
+
+    /** The arena block. */
+    void *arena;
+
+    /** The next free byte of the arena (while carving it up). */
+    char *top;
+
+    /** The work arrays of the solver proper. */
+    double *newX;
+    double *xBefore;
+    double *delta;
+
+    /** The work arrays of the exploratory moves. */
+    double *z;
+    double *zMinus;
+    double *fPoll;
+    double *zLanes;
+
+    /** The list of the coordinates moved off the base point. */
+    unsigned int *moved;
+
+    /** The membership marks of the moved coordinates list. */
+    unsigned char *marks;
+
+    /**
+     * Helper method.
+     * <br />
+     * <br />Carves an aligned array out of the arena.
+     *
+     * @param size The size of the array, in bytes.
+     *
+     * @return The array.
+     */
+    void *carve(const std::size_t);
+
+    /** Copying is not allowed. */
+    Workspace(const Workspace &);
+    Workspace &operator=(const Workspace &);
+
+public:
+    /**
+     * Getter for <code>newX</code>.
+     *
+     * @return The new point coordinates (nVars).
+     */
+    double *getNewX();
+
+    /**
+     * Getter for <code>xBefore</code>.
+     *
+     * @return The base point coordinates (nVars).
+     */
+    double *getXBefore();
+
+    /**
+     * Getter for <code>delta</code>.
+     *
+     * @return The per-coordinate steps (nVars).
+     */
+    double *getDelta();
+
+    /**
+     * Getter for <code>z</code>.
+     *
+     * @return The probe point coordinates (nVars).
+     */
+    double *getZ();
+
+    /**
+     * Getter for <code>zMinus</code>.
+     *
+     * @return The -delta probe point coordinates (nVars).
+     */
+    double *getZMinus();
+
+    /**
+     * Getter for <code>fPoll</code>.
+     *
+     * @return The poll point values (2 * nVars).
+     */
+    double *getFPoll();
+
+    /**
+     * Getter for <code>moved</code>.
+     *
+     * @return The list of the moved coordinates (nVars).
+     */
+    unsigned int *getMoved();
+
+    /**
+     * Getter for <code>marks</code>.
+     *
+     * @return The membership marks of the moved coordinates list (nVars),
+     *         all clear on construction.
+     */
+    unsigned char *getMarks();
+
+    /**
+     * Getter for a lane of <code>zLanes</code>.
+     *
+     * @param lane The poll worker index.
+     *
+     * @return The probe point coordinates of the worker (nVars).
+     */
+    double *getZLane(const unsigned int);
+
+    /**
+     * Getter for the size of the work arrays.
+     *
+     * @return The number of bytes carved out of the arena.
+     */
+    std::size_t getSize() const;
+
+    /**
+     * Tells whether a solve fits the workspace.
+     *
+     * @param __nVars  The number of variables.
+     * @param __nLanes The number of concurrent poll workers.
+     *
+     * @return <code>true</code> if the arrays are large enough.
+     */
+    bool fits(const unsigned int, const unsigned int) const;
+
+    /**
+     * Constructor.
+     *
+     * @param __nVars  The number of variables.
+     * @param __nLanes The number of concurrent poll workers.
+     *
+     * @throws std::bad_alloc If the arena cannot be allocated.
+     */
+    Workspace(const unsigned int, const unsigned int = 1);
+
+    /** Destructor. */
+    ~Workspace();
+};
+
+// Getter for the size of the work arrays.
+inline std::size_t Workspace::getSize() const {
+    return (std::size_t) (top - (char *) arena);
+}
+
+// Getter for newX.
+inline double *Workspace::getNewX() {
+    return newX;
+}
+
+// Getter for xBefore.
+inline double *Workspace::getXBefore() {
+    return xBefore;
+}
+
+// Getter for delta.
+inline double *Workspace::getDelta() {
+    return delta;
+}
+
+// Getter for z.
+inline double *Workspace::getZ() {
+    return z;
+}
+
+// Getter for zMinus.
+inline double *Workspace::getZMinus() {
+    return zMinus;
+}
+
+// Getter for fPoll.
+inline double *Workspace::getFPoll() {
+    return fPoll;
+}
+
+// Getter for moved.
+inline unsigned int *Workspace::getMoved() {
+    return moved;
+}
+
+// Getter for marks.
+inline unsigned char *Workspace::getMarks() {
+    return marks;
+}
+
+// Getter for a lane of zLanes.
+inline double *Workspace::getZLane(const unsigned int lane) {
+    return (zLanes + lane * row);
+}
+
+// Tells whether a solve fits the workspace.
+inline bool Workspace::fits(const unsigned int __nVars,
+                            const unsigned int __nLanes) const {
+
+    return ((__nVars <= nVars) && (__nLanes <= nLanes));
+}
+
+} // namespace NLPUCCLIHooke
+
+#endif // __CC__WORKSPACE_H
+
+// vim:set nu et ts=4 sw=4:
@@ -0,0 +1,226 @@
+/*
+ * nlp-unconstrained-cli/nelder-mead/c/src/evalpool.c
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Nelder-Mead nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+/* For poll() (not in the C standard). */
+#define _DEFAULT_SOURCE
+
+#include <errno.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "evalpool.h"
+
+/* Helper function. Sends a request to a worker. */
+static int send_request(struct eval_pool *pool,
+                        struct eval_worker *w,
+                        const uint32_t tag,
+                        const double *x,
+                        const unsigned int n) {
+
+    return eval_send_request(w->fd, tag, x, n, 1, &pool->frame,
+                             &pool->frame_size);
+}
+
+/* Constructor. */
+struct eval_pool *eval_pool_open(const char *command,
+                                 const char *problem,
+                                 const unsigned int workers,
+                                 const unsigned int depth) {
+
+    unsigned int k;
+    unsigned int nworkers = (workers == 0) ? 1 : workers;
+
+    int fd;
+
+    pid_t pid;
+
+    struct eval_pool *pool = malloc(sizeof(*pool));
+
+    if (pool == NULL) {
+        return NULL;
+    }
+
+    pool->size       = 0;
+    pool->depth      = (depth == 0) ? 1 : depth;
+    pool->failed     = 0;
+    pool->frame      = NULL;
+    pool->frame_size = 0;
+    pool->workers    = malloc(nworkers * sizeof(struct eval_worker));
+
+    if (pool->workers == NULL) {
+        free(pool);
+
+        return NULL;
+    }
+
+    /* Nothing buffered must get written by the workers again. */
+    fflush(stdout);
+
+    for (k = 0; k < nworkers; k++) {
+        if ((fd = eval_spawn(command, problem, &pid)) < 0) {
+            break;
+        }
+
+        pool->workers[pool->size].pid         = pid;
+        pool->workers[pool->size].fd          = fd;
+        pool->workers[pool->size].outstanding = 0;
+
+        pool->size++;
+    }
+
+    if (pool->size == 0) {
+        pool->failed = 1;
+    }
+
+    return pool;
+}
+
+/* Evaluates f(x) at one point. */
+double eval_pool_eval(struct eval_pool *pool,
+                      const double *x,
+                      const unsigned int n) {
+
+    struct eval_reply reply;
+
+    if (pool->failed) {
+        return NAN;
+    }
+
+    if (!send_request(pool, &pool->workers[0], 0, x, n)
+        || !eval_receive_reply(pool->workers[0].fd, &reply)
+        || (reply.tag != 0)) {
+
+        pool->failed = 1;
+
+        return NAN;
+    }
+
+    return reply.f;
+}
+
+/* Evaluates f(x) at m points, pipelined across the workers. */
+void eval_pool_batch(struct eval_pool *pool,
+                     const double *x,
+                     const unsigned int n,
+                     const unsigned int m,
+                     double *y) {
+
+    unsigned int c;
+    unsigned int k;
+    unsigned int next = 0;
+    unsigned int done = 0;
+
+    int ok = !pool->failed;
+
+    struct eval_reply reply;
+
+    struct pollfd *fds = malloc(pool->size * sizeof(struct pollfd));
+
+    if (fds == NULL) {
+        ok = 0;
+    }
+
+    while (ok && (done < m)) {
+        /* Topping every worker up to depth outstanding requests. */
+        for (c = 0; ok && (c < pool->size); c++) {
+            struct eval_worker *w = &pool->workers[c];
+
+            while (ok && (w->outstanding < pool->depth) && (next < m)) {
+                ok = send_request(pool, w, next, x + (size_t) next * n, n);
+
+                w->outstanding++;
+                next++;
+            }
+
+            fds[c].fd      = w->fd;
+            fds[c].events  = (w->outstanding > 0) ? POLLIN : 0;
+            fds[c].revents = 0;
+        }
+
+        if (!ok) {
+            break;
+        }
+
+        if (poll(fds, pool->size, -1) < 0) {
+            ok = (errno == EINTR);
+
+            continue;
+        }
+
+        for (c = 0; ok && (c < pool->size); c++) {
+            if (fds[c].revents == 0) {
+                continue;
+            }
+
+            ok = eval_receive_reply(pool->workers[c].fd, &reply)
+              && (reply.tag < m);
+
+            if (ok) {
+                y[reply.tag] = reply.f;
+
+                pool->workers[c].outstanding--;
+
+                done++;
+            }
+        }
+    }
+
+    if (!ok) {
+        pool->failed = 1;
+
+        for (k = 0; k < m; k++) {
+            y[k] = NAN;
+        }
+    }
+
+    free(fds);
+}
+
+/* Destructor. */
+void eval_pool_close(struct eval_pool *pool) {
+    unsigned int k;
+
+    if (pool == NULL) {
+        return;
+    }
+
+    /* The end of the input tells the workers to exit. */
+    for (k = 0; k < pool->size; k++) {
+        close(pool->workers[k].fd);
+    }
+
+    for (k = 0; k < pool->size; k++) {
+        waitpid(pool->workers[k].pid, NULL, 0);
+    }
+
+    free(pool->workers);
+    free(pool->frame);
+    free(pool);
+}
+
+/* vim:set nu et ts=4 sw=4: */
@@ -0,0 +1,146 @@
+/*
+ * nlp-unconstrained-cli/nelder-mead/c/src/evalpool.h
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Nelder-Mead nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+/**
+ * The <code>evalpool.h</code> header file declares the evaluation pool:
+ * the objective function evaluated out of process by long-lived worker
+ * processes. The protocol, and the code speaking it, are the ones
+ * of the Hooke and Jeeves trees (see <code>evalwire.h</code>),
+ * so the workers of either tree serve both.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @since   nelder-mead 0.1
+ */
+
+#ifndef __C__EVALPOOL_H
+#define __C__EVALPOOL_H
+
+#include <sys/types.h>
+
+/*
+ * The evaluation worker protocol (shared with the Hooke and Jeeves trees,
+ * so the pool and the workers of either tree speak the one protocol).
+ */
+#include "../../../hooke-jeeves/c/src/evalwire.h"
+
+/** Constant. The default number of the outstanding requests per worker. */
+#define EVAL_DEPTH 8
+
+/** A worker process. */
+struct eval_worker {
+    /** The process id. */
+    pid_t pid;
+
+    /** The socket to the process. */
+    int fd;
+
+    /** The number of the outstanding requests. */
+    unsigned int outstanding;
+};
+
+/**
+ * The structure to hold a pool of worker processes. Once a worker fails
+ * (dies or talks nonsense) the pool is failed: every evaluation from then
+ * on gets a NaN.
+ */
+struct eval_pool {
+    /** The workers. */
+    struct eval_worker *workers;
+
+    /** The number of the workers running. */
+    unsigned int size;
+
+    /** The number of the outstanding requests per worker of a batch. */
+    unsigned int depth;
+
+    /** Whether a worker has failed (or has not started). */
+    int failed;
+
+    /** The request frame (built in place). */
+    char *frame;
+
+    /** The size of the request frame. */
+    size_t frame_size;
+};
+
+/**
+ * Constructor.
+ * <br />
+ * <br />Starts the workers: the words of the command (split
+ * at the spaces), then the problem name.
+ *
+ * @param command The worker command.
+ * @param problem The problem name.
+ * @param workers The number of workers (at least one is started).
+ * @param depth   The number of the outstanding requests per worker
+ *                of a batch.
+ *
+ * @return The pool (failed, if no worker has started), or <code>NULL</code>
+ *         if there is no memory for it.
+ */
+extern struct eval_pool *eval_pool_open(const char *,
+                                        const char *,
+                                        const unsigned int,
+                                        const unsigned int);
+
+/**
+ * Evaluates f(x) at one point (a round trip to the first worker).
+ *
+ * @param pool The pool.
+ * @param x    The point.
+ * @param n    The number of coordinates of <code>x</code>.
+ *
+ * @return The objective function value (NaN if the pool is failed).
+ */
+extern double eval_pool_eval(struct eval_pool *,
+                             const double *,
+                             const unsigned int);
+
+/**
+ * Evaluates f(x) at m points, keeping up to <code>depth</code> requests
+ * outstanding on every worker and reading the replies as they come in.
+ *
+ * @param pool The pool.
+ * @param x    The points (point k at <code>x[k * n]</code>).
+ * @param n    The number of coordinates of a point.
+ * @param m    The number of points.
+ * @param y    The objective function values (output, m; NaN
+ *             if the pool is failed).
+ */
+extern void eval_pool_batch(struct eval_pool *,
+                            const double *,
+                            const unsigned int,
+                            const unsigned int,
+                            double *);
+
+/**
+ * Destructor. Closes the sockets and waits for the workers.
+ *
+ * @param pool The pool (may be <code>NULL</code>).
+ */
+extern void eval_pool_close(struct eval_pool *);
+
+#endif /* __C__EVALPOOL_H */
+
+/* vim:set nu et ts=4 sw=4: */
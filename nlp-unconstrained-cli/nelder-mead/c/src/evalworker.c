@@ -0,0 +1,82 @@
+/*
+ * nlp-unconstrained-cli/nelder-mead/c/src/evalworker.c
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Nelder-Mead nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mgh.h"
+#include "evalpool.h"
+
+/* Helper constant (the worker command-line option). */
+#define DELAY_OPTION "--delay-us="
+
+/* Helper function. Evaluates the problem the worker serves. */
+static double evaluate(const double *x, const unsigned int n, void *data) {
+    const struct mgh_problem *problem = data;
+
+    return problem->fn(x, n);
+}
+
+/*
+ * Main program function main() :-).
+ * The stand-in evaluation worker: evaluates the requests one by one,
+ * optionally sleeping as long as a real simulator would take.
+ */
+int main(int argc, char **argv) {
+    int arg;
+
+    unsigned int k;
+    unsigned int delay = 0;
+
+    const char *name = NULL;
+
+    const struct mgh_problem *problem = NULL;
+
+    for (arg = 1; arg < argc; arg++) {
+        if (strncmp(argv[arg], DELAY_OPTION, strlen(DELAY_OPTION)) == 0) {
+            delay = strtoul(argv[arg] + strlen(DELAY_OPTION), NULL, 10);
+        } else {
+            name = argv[arg];
+        }
+    }
+
+    for (k = 0; (name != NULL) && (k < MGH_N_PROBLEMS); k++) {
+        if (strcmp(MGH_PROBLEMS[k].name, name) == 0) {
+            problem = &MGH_PROBLEMS[k];
+        }
+    }
+
+    if (problem == NULL) {
+        fprintf(stderr, "Usage: %s [%sMICROSECONDS] PROBLEM\n", argv[0],
+                DELAY_OPTION);
+
+        return EXIT_FAILURE;
+    }
+
+    /* The problems take their own number of variables only. */
+    return eval_serve(evaluate, (void *) problem, problem->n, problem->n,
+                      delay);
+}
+
+/* vim:set nu et ts=4 sw=4: */
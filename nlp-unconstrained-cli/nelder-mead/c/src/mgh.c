@@ -0,0 +1,476 @@
+/*
+ * nlp-unconstrained-cli/nelder-mead/c/src/mgh.c
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Nelder-Mead nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+#include "mgh.h"
+
+/* Helper constants (the problem data). */
+#define TWO_PI         6.283185307179586
+#define BIGGS_M       13
+#define GAUSSIAN_M    15
+#define BOX_M         10
+#define WATSON_M      29
+#define PENALTY_A      1E-5
+#define BROWN_DENN_M  20
+#define GULF_M        99
+#define BEALE_M        3
+
+static const double GAUSSIAN_Y[GAUSSIAN_M] = {
+    .0009, .0044, .0175, .0540, .1295, .2420, .3521, .3989,
+    .3521, .2420, .1295, .0540, .0175, .0044, .0009
+};
+
+static const double BEALE_Y[BEALE_M] = {1.5, 2.25, 2.625};
+
+/* The objective functions (14 and 17 being Rosenbrock and Woods). */
+static double rosenbrock(const double *x, const unsigned int n) {
+    double s = 0;
+    double a;
+    double b;
+
+    unsigned int i;
+
+    for (i = 0; i + 1 < n; i++) {
+        a  = 1 - x[i];
+        b  = x[i + 1] - x[i] * x[i];
+        s += a * a + 100 * (b * b);
+    }
+
+    return s;
+}
+
+/* Woods is summed over the n / 4 blocks of four coordinates. */
+static double woods(const double *x, const unsigned int n) {
+    double s = 0;
+    double s1;
+    double s2;
+    double s3;
+    double t1;
+    double t2;
+    double t3;
+    double t4;
+    double t5;
+
+    unsigned int k;
+
+    for (k = 0; k + 3 < n; k += 4) {
+        s1 = x[k + 1] - x[k] * x[k];
+        s2 = 1        - x[k];
+        s3 = x[k + 1] - 1;
+        t1 = x[k + 3] - x[k + 2] * x[k + 2];
+        t2 = 1        - x[k + 2];
+        t3 = x[k + 3] - 1;
+        t4 = s3 + t3;
+        t5 = s3 - t3;
+
+        s += 100 * (s1 * s1) + s2 * s2 + 90 * (t1 * t1) + t2 * t2
+           + 10 * (t4 * t4) + t5 * t5 / 10;
+    }
+
+    return s;
+}
+
+static double helical(const double *x, const unsigned int n) {
+    double theta;
+    double r1;
+    double r2;
+
+    if (x[0] > 0) {
+        theta = atan(x[1] / x[0]) / TWO_PI;
+    } else if (x[0] < 0) {
+        theta = atan(x[1] / x[0]) / TWO_PI + .5;
+    } else {
+        theta = (x[1] < 0) ? -.25 : .25;
+    }
+
+    r1 = 10 * (x[2] - 10 * theta);
+    r2 = 10 * (sqrt(x[0] * x[0] + x[1] * x[1]) - 1);
+
+    return (r1 * r1 + r2 * r2 + x[2] * x[2]);
+}
+
+static double biggs(const double *x, const unsigned int n) {
+    double s = 0;
+    double t;
+    double r;
+
+    unsigned int i;
+
+    for (i = 1; i <= BIGGS_M; i++) {
+        t = .1 * i;
+
+        r = x[2] * exp(-t * x[0]) - x[3] * exp(-t * x[1])
+          + x[5] * exp(-t * x[4])
+          - (exp(-t) - 5 * exp(-10 * t) + 3 * exp(-4 * t));
+
+        s += r * r;
+    }
+
+    return s;
+}
+
+static double gaussian(const double *x, const unsigned int n) {
+    double s = 0;
+    double t;
+    double r;
+
+    unsigned int i;
+
+    for (i = 0; i < GAUSSIAN_M; i++) {
+        t = (7.0 - i) / 2;
+        r = x[0] * exp(-x[1] * (t - x[2]) * (t - x[2]) / 2) - GAUSSIAN_Y[i];
+
+        s += r * r;
+    }
+
+    return s;
+}
+
+static double powellbs(const double *x, const unsigned int n) {
+    double r1 = 1E4 * x[0] * x[1] - 1;
+    double r2 = exp(-x[0]) + exp(-x[1]) - 1.0001;
+
+    return (r1 * r1 + r2 * r2);
+}
+
+static double box(const double *x, const unsigned int n) {
+    double s = 0;
+    double t;
+    double r;
+
+    unsigned int i;
+
+    for (i = 1; i <= BOX_M; i++) {
+        t = .1 * i;
+        r = exp(-t * x[0]) - exp(-t * x[1])
+          - x[2] * (exp(-t) - exp(-10 * t));
+
+        s += r * r;
+    }
+
+    return s;
+}
+
+static double vardim(const double *x, const unsigned int n) {
+    double s = 0;
+    double v = 0;
+
+    unsigned int j;
+
+    for (j = 0; j < n; j++) {
+        s += (x[j] - 1) * (x[j] - 1);
+        v += (j + 1) * (x[j] - 1);
+    }
+
+    return (s + v * v + (v * v) * (v * v));
+}
+
+static double watson(const double *x, const unsigned int n) {
+    double s = 0;
+    double t;
+    double d;
+    double s1;
+    double s2;
+    double r;
+
+    unsigned int i;
+    unsigned int j;
+
+    for (i = 1; i <= WATSON_M; i++) {
+        t  = i / 29.0;
+        s1 = 0;
+        d  = 1;
+
+        for (j = 1; j < n; j++) {
+            s1 += j * x[j] * d;
+            d  *= t;
+        }
+
+        s2 = 0;
+        d  = 1;
+
+        for (j = 0; j < n; j++) {
+            s2 += x[j] * d;
+            d  *= t;
+        }
+
+        r  = s1 - s2 * s2 - 1;
+        s += r * r;
+    }
+
+    r = x[1] - x[0] * x[0] - 1;
+
+    return (s + x[0] * x[0] + r * r);
+}
+
+static double penalty1(const double *x, const unsigned int n) {
+    double s = 0;
+    double v = 0;
+
+    unsigned int j;
+
+    for (j = 0; j < n; j++) {
+        s += PENALTY_A * (x[j] - 1) * (x[j] - 1);
+        v += x[j] * x[j];
+    }
+
+    return (s + (v - .25) * (v - .25));
+}
+
+static double penalty2(const double *x, const unsigned int n) {
+    double s = (x[0] - .2) * (x[0] - .2);
+    double v = 0;
+    double r;
+
+    unsigned int j;
+
+    for (j = 1; j < n; j++) {
+        r  = exp(x[j] / 10) + exp(x[j - 1] / 10)
+           - (exp((j + 1) / 10.0) + exp(j / 10.0));
+        s += PENALTY_A * r * r;
+
+        r  = exp(x[j] / 10) - exp(-.1);
+        s += PENALTY_A * r * r;
+    }
+
+    for (j = 0; j < n; j++) {
+        v += (n - j) * x[j] * x[j];
+    }
+
+    return (s + (v - 1) * (v - 1));
+}
+
+static double brownbs(const double *x, const unsigned int n) {
+    double r1 = x[0] - 1E6;
+    double r2 = x[1] - 2E-6;
+    double r3 = x[0] * x[1] - 2;
+
+    return (r1 * r1 + r2 * r2 + r3 * r3);
+}
+
+static double browndennis(const double *x, const unsigned int n) {
+    double s = 0;
+    double t;
+    double u;
+    double v;
+    double r;
+
+    unsigned int i;
+
+    for (i = 1; i <= BROWN_DENN_M; i++) {
+        t = i / 5.0;
+        u = x[0] + t * x[1] - exp(t);
+        v = x[2] + x[3] * sin(t) - cos(t);
+        r = u * u + v * v;
+
+        s += r * r;
+    }
+
+    return s;
+}
+
+static double gulf(const double *x, const unsigned int n) {
+    double s = 0;
+    double t;
+    double y;
+    double r;
+
+    unsigned int i;
+
+    for (i = 1; i <= GULF_M; i++) {
+        t = i / 100.0;
+        y = 25 + pow(-50 * log(t), 2 / 3.0);
+        r = exp(-pow(fabs(y - x[1]), x[2]) / x[0]) - t;
+
+        s += r * r;
+    }
+
+    return s;
+}
+
+static double trig(const double *x, const unsigned int n) {
+    double s = 0;
+    double c = 0;
+    double r;
+
+    unsigned int j;
+
+    for (j = 0; j < n; j++) {
+        c += cos(x[j]);
+    }
+
+    for (j = 0; j < n; j++) {
+        r  = n - c + (j + 1) * (1 - cos(x[j])) - sin(x[j]);
+        s += r * r;
+    }
+
+    return s;
+}
+
+static double powell(const double *x, const unsigned int n) {
+    double s = 0;
+    double r1;
+    double r2;
+    double r3;
+    double r4;
+
+    unsigned int k;
+
+    for (k = 0; k + INDEX_3 < n; k += 4) {
+        r1 = x[k]     + 10 * x[k + 1];
+        r2 = x[k + 2] -      x[k + 3];
+        r3 = x[k + 1] -  2 * x[k + 2];
+        r4 = x[k]     -      x[k + 3];
+
+        s += r1 * r1 + 5 * r2 * r2 + (r3 * r3) * (r3 * r3)
+                                   + 10 * (r4 * r4) * (r4 * r4);
+    }
+
+    return s;
+}
+
+static double beale(const double *x, const unsigned int n) {
+    double s = 0;
+    double d = 1;
+    double r;
+
+    unsigned int i;
+
+    for (i = 0; i < BEALE_M; i++) {
+        d *= x[1];
+        r  = BEALE_Y[i] - x[0] * (1 - d);
+        s += r * r;
+    }
+
+    return s;
+}
+
+static double chebyquad(const double *x, const unsigned int n) {
+    double s = 0;
+    double a[VARS];
+    double y;
+    double t0;
+    double t1;
+    double t2;
+    double r;
+
+    unsigned int i;
+    unsigned int j;
+
+    for (i = 0; i < n; i++) {
+        a[i] = 0;
+    }
+
+    /* The shifted Chebyshev polynomials T1..Tn at every coordinate. */
+    for (j = 0; j < n; j++) {
+        y  = 2 * x[j] - 1;
+        t0 = 1;
+        t1 = y;
+
+        for (i = 0; i < n; i++) {
+            a[i] += t1;
+            t2    = 2 * y * t1 - t0;
+            t0    = t1;
+            t1    = t2;
+        }
+    }
+
+    /* Minus the integral over [0, 1]: -1 / (i^2 - 1) for an even i. */
+    for (i = 1; i <= n; i++) {
+        r = a[i - 1] / n;
+
+        if (i % 2 == 0) {
+            r += 1.0 / ((double) i * i - 1);
+        }
+
+        s += r * r;
+    }
+
+    return s;
+}
+
+/* The standard starting guesses. */
+static const double ROSENBROCK_START[]  = {-1.2, 1};
+static const double WOODS_START[]       = {-3, -1, -3, -1};
+static const double HELICAL_START[]     = {-1, 0, 0};
+static const double BIGGS_START[]       = {1, 2, 1, 1, 1, 1};
+static const double GAUSSIAN_START[]    = {.4, 1, 0};
+static const double POWELLBS_START[]    = {0, 1};
+static const double BOX_START[]         = {0, 10, 20};
+static const double VARDIM_START[]      = {
+    .9, .8, .7, .6, .5, .4, .3, .2, .1, 0
+};
+static const double WATSON_START[]      = {0, 0, 0, 0, 0, 0};
+static const double PENALTY1_START[]    = {1, 2, 3, 4};
+static const double PENALTY2_START[]    = {.5, .5, .5, .5};
+static const double BROWNBS_START[]     = {1, 1};
+static const double BROWNDENNIS_START[] = {25, 5, -5, -1};
+static const double GULF_START[]        = {5, 2.5, .15};
+static const double TRIG_START[]        = {
+    .1, .1, .1, .1, .1, .1, .1, .1, .1, .1
+};
+static const double POWELL_START[]      = {3, -1, 0, 1};
+static const double BEALE_START[]       = {1, 1};
+static const double CHEBYQUAD_START[]   = {
+    1 / 9., 2 / 9., 3 / 9., 4 / 9., 5 / 9., 6 / 9., 7 / 9., 8 / 9.
+};
+
+/* The test problems. */
+const struct mgh_problem MGH_PROBLEMS[] = {
+    {"rosenbrock",   2, ROSENBROCK_START,  rosenbrock},
+    {"woods",        4, WOODS_START,       woods},
+    {"helical",      3, HELICAL_START,     helical},
+    {"biggs",        6, BIGGS_START,       biggs},
+    {"gaussian",     3, GAUSSIAN_START,    gaussian},
+    {"powellbs",     2, POWELLBS_START,    powellbs},
+    {"box",          3, BOX_START,         box},
+    {"vardim",      10, VARDIM_START,      vardim},
+    {"watson",       6, WATSON_START,      watson},
+    {"penalty1",     4, PENALTY1_START,    penalty1},
+    {"penalty2",     4, PENALTY2_START,    penalty2},
+    {"brownbs",      2, BROWNBS_START,     brownbs},
+    {"browndennis",  4, BROWNDENNIS_START, browndennis},
+    {"gulf",         3, GULF_START,        gulf},
+    {"trig",        10, TRIG_START,        trig},
+    {"powell",       4, POWELL_START,      powell},
+    {"beale",        2, BEALE_START,       beale},
+    {"chebyquad",    8, CHEBYQUAD_START,   chebyquad}
+};
+
+/* The number of the test problems. */
+const unsigned int MGH_N_PROBLEMS = sizeof(MGH_PROBLEMS)
+                                  / sizeof(MGH_PROBLEMS[0]);
+
+/* The test problem selected. */
+static const struct mgh_problem *selected = MGH_PROBLEMS;
+
+/* Selects the test problem f() evaluates. */
+void mgh_select(const struct mgh_problem *problem) {
+    selected = problem;
+}
+
+/* The user-supplied objective function f(x). */
+double f(const double *x) {
+    return selected->fn(x, selected->n);
+}
+
+/* vim:set nu et ts=4 sw=4: */
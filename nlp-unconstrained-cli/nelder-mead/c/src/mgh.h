@@ -0,0 +1,107 @@
+/*
+ * nlp-unconstrained-cli/nelder-mead/c/src/mgh.h
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Nelder-Mead nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+/**
+ * The <code>mgh.h</code> header file contains function prototypes
+ * for solving a nonlinear optimization problem using the algorithm
+ * of Nelder and Mead (&quot;Downhill simplex method&quot;).
+ * <br />
+ * <br />The objective functions in this case are the unconstrained
+ * minimization problems 1 to 18 of More, Garbow &amp; Hillstrom
+ * (TOMS algorithm 566), the same ones and in the same order
+ * as the problem registry of the C++ Hooke and Jeeves solver has them
+ * (see <code>hooke-jeeves/cc/src/mgh.h</code>), so that the benchmark
+ * tables of both solvers line up.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @since   nelder-mead 0.1
+ */
+
+#ifndef __C__MGH_H
+#define __C__MGH_H
+
+#include "nelmin.h"
+
+/** Constant. The number of timed solves per problem of a benchmark. */
+#define MGH_REPS 5
+
+/** Constant. The maximum number of function evaluations of a solve. */
+#define MGH_KCOUNT 100000
+
+/** Constant. The header line of the benchmark table. */
+#define MGH_HEADER \
+    "problem        n    iters   funevals      seconds           f(x)"
+
+/** Constant. The layout of a row of the benchmark table. */
+#define MGH_ROW "%-12s%4u%9u%11u%13.6f%15.6e\n"
+
+/** A test problem: an objective function and its standard setup. */
+struct mgh_problem {
+    /** The name the problem is selected by. */
+    const char *name;
+
+    /** The number of variables. */
+    unsigned int n;
+
+    /** The standard starting guess. */
+    const double *start;
+
+    /**
+     * The objective function f(x,n).
+     *
+     * @param x The point at which f(x) should be evaluated.
+     * @param n The number of coordinates of <code>x</code>.
+     *
+     * @return The objective function value.
+     */
+    double (*fn)(const double *, const unsigned int);
+};
+
+/** The test problems. */
+extern const struct mgh_problem MGH_PROBLEMS[];
+
+/** The number of the test problems. */
+extern const unsigned int MGH_N_PROBLEMS;
+
+/**
+ * Selects the test problem <code>f()</code> evaluates.
+ *
+ * @param problem The test problem.
+ */
+extern void mgh_select(const struct mgh_problem *);
+
+/**
+ * The user-supplied objective function f(x).
+ * <br />
+ * <br />Evaluates the objective function of the test problem selected.
+ *
+ * @param x The point at which f(x) should be evaluated.
+ *
+ * @return The objective function value.
+ */
+extern double f(const double *);
+
+#endif /* __C__MGH_H */
+
+/* vim:set nu et ts=4 sw=4: */
@@ -0,0 +1,216 @@
+/*
+ * nlp-unconstrained-cli/nelder-mead/c/src/mghbench.c
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Nelder-Mead nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+/* For clock_gettime() (not in the C standard). */
+#define _POSIX_C_SOURCE 199309L
+
+#include <string.h>
+#include <time.h>
+
+#include "mgh.h"
+#include "evalpool.h"
+
+/* Helper constant (the benchmark command-line options). */
+#define BENCH_OPTION          "--bench="
+#define OBJECTIVE_OPTION      "--objective="
+#define REMOTE_OPTION         "--remote="
+#define REMOTE_WORKERS_OPTION "--remote-workers="
+
+/* The evaluation pool of the problem being solved out of process. */
+static struct eval_pool *pool = NULL;
+
+/* Helper function. The objective function evaluated by the pool. */
+static double remote_fn(const double *x, const unsigned int n) {
+    return eval_pool_eval(pool, x, n);
+}
+
+/* Helper function. The batch objective function evaluated by the pool. */
+static void remote_batch(const double *x,
+                         const unsigned int n,
+                         const unsigned int m,
+                         double *y) {
+
+    eval_pool_batch(pool, x, n, m, y);
+}
+
+/*
+ * Helper function.
+ * Solves a test problem from its standard starting guess reps times
+ * and prints one row of the benchmark table: the number of simplex steps
+ * and of function evaluations, the best wall time of a solve, and f(x)
+ * at the estimate of the minimizing point.
+ */
+static void bench(const struct mgh_problem *problem,
+                  const unsigned int        reps) {
+
+    unsigned int r;
+    unsigned int i;
+    unsigned int steps  = 0;
+    unsigned int icount = 0;
+
+    double start[VARS];
+    double step[VARS];
+    double ynewlo = 0;
+    double t;
+    double best   = 0;
+
+    struct timespec t0;
+    struct timespec t1;
+
+    struct optimum *opt;
+
+    mgh_select(problem);
+
+    for (i = 0; i < problem->n; i++) {
+        step[i] = STEP_GUESS_1;
+    }
+
+    for (r = 0; r < reps; r++) {
+        /* A restart moves the starting point: it is set up every time. */
+        for (i = 0; i < problem->n; i++) {
+            start[i] = problem->start[i];
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+
+        opt = nelmin(problem->n, start, REQMIN_GUESS, step, KONVGE_GUESS,
+                     MGH_KCOUNT);
+
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+
+        t = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1E9;
+
+        if ((r == 0) || (t < best)) {
+            best = t;
+        }
+
+        icount = opt->indics[INDEX_0];
+        steps  = opt->indics[INDEX_3];
+        ynewlo = opt->ynewlo;
+
+        free(opt);
+    }
+
+    printf(MGH_ROW, problem->name, problem->n, steps, icount, best, ynewlo);
+}
+
+/*
+ * Helper function.
+ * Benchmarks a test problem with its objective function evaluated
+ * by a pool of worker processes instead of in process: the vertices
+ * of the initial and of the shrunk simplices are evaluated at once.
+ */
+static int bench_remote(const struct mgh_problem *problem,
+                        const unsigned int        reps,
+                        const char               *command,
+                        const unsigned int        workers) {
+
+    int ret = 1;
+
+    struct mgh_problem remote = *problem;
+
+    remote.fn = remote_fn;
+
+    if ((pool = eval_pool_open(command, problem->name, workers,
+                               EVAL_DEPTH)) == NULL) {
+
+        return 0;
+    }
+
+    set_batch_f(remote_batch);
+
+    bench(&remote, reps);
+
+    set_batch_f(NULL);
+
+    if (pool->failed) {
+        ret = 0;
+    }
+
+    eval_pool_close(pool);
+
+    pool = NULL;
+
+    return ret;
+}
+
+/* Main program function main() :-). */
+int main(int argc, char **argv) {
+    int arg;
+
+    unsigned int k;
+    unsigned int reps    = MGH_REPS;
+    unsigned int workers = 1;
+
+    const char *name    = NULL;
+    const char *command = NULL;
+
+    for (arg = 1; arg < argc; arg++) {
+        if ((strncmp(argv[arg], BENCH_OPTION, strlen(BENCH_OPTION)) == 0)
+            && (atoi(argv[arg] + strlen(BENCH_OPTION)) > 0)) {
+
+            reps = atoi(argv[arg] + strlen(BENCH_OPTION));
+        } else if (strncmp(argv[arg], OBJECTIVE_OPTION,
+                           strlen(OBJECTIVE_OPTION)) == 0) {
+
+            name = argv[arg] + strlen(OBJECTIVE_OPTION);
+        } else if (strncmp(argv[arg], REMOTE_OPTION,
+                           strlen(REMOTE_OPTION)) == 0) {
+
+            command = argv[arg] + strlen(REMOTE_OPTION);
+        } else if ((strncmp(argv[arg], REMOTE_WORKERS_OPTION,
+                            strlen(REMOTE_WORKERS_OPTION)) == 0)
+                   && (atoi(argv[arg] + strlen(REMOTE_WORKERS_OPTION)) > 0)) {
+
+            workers = atoi(argv[arg] + strlen(REMOTE_WORKERS_OPTION));
+        } else {
+            fprintf(stderr, "Usage: %s [%sREPS] [%sNAME]"
+                            " [%sCOMMAND [%sK]]\n", argv[0],
+                    BENCH_OPTION, OBJECTIVE_OPTION, REMOTE_OPTION,
+                    REMOTE_WORKERS_OPTION);
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    puts(MGH_HEADER);
+
+    for (k = 0; k < MGH_N_PROBLEMS; k++) {
+        if ((name != NULL) && (strcmp(MGH_PROBLEMS[k].name, name) != 0)) {
+            continue;
+        }
+
+        if (command == NULL) {
+            bench(&MGH_PROBLEMS[k], reps);
+        } else if (!bench_remote(&MGH_PROBLEMS[k], reps, command, workers)) {
+            fprintf(stderr, "%s: %s: the evaluation workers have failed\n",
+                    argv[0], MGH_PROBLEMS[k].name);
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/* vim:set nu et ts=4 sw=4: */
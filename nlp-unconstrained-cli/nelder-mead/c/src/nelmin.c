@@ -21,12 +21,63 @@
  * (See the LICENSE file at the top of the source tree.)
  */
 
-#ifndef WOODS
+#include <string.h>
+
+#if defined(MGH)
+    #include "mgh.h"
+#elif !defined(WOODS)
     #include "rosenbrock.h"
 #else
     #include "woods.h"
 #endif
 
+/* The binary trace (if any) the simplex step records go to. */
+static struct bin_trace *bin_trace = NULL;
+
+/* Setter for the binary trace. */
+void set_bin_trace(struct bin_trace *__bin_trace) {
+    bin_trace = __bin_trace;
+}
+
+/* The batch objective function (if any) the simplex vertices go to. */
+static void (*batch_f)(const double *,
+                       const unsigned int,
+                       const unsigned int,
+                       double *) = NULL;
+
+/* Setter for the batch objective function. */
+void set_batch_f(void (*__batch_f)(const double *,
+                                   const unsigned int,
+                                   const unsigned int,
+                                   double *)) {
+
+    batch_f = __batch_f;
+}
+
+/*
+ * Helper function.
+ * Evaluates all the nn vertices of the simplex p in one call
+ * to the batch objective function.
+ */
+static void batch_simplex(double p[VARS][VARS + 1],
+                          const unsigned int n,
+                          const unsigned int nn,
+                          double *y) {
+
+    unsigned int i;
+    unsigned int j;
+
+    double x[(VARS + 1) * VARS];
+
+    for (j = 0; j < nn; j++) {
+        for (i = 0; i < n; i++) {
+            x[j * n + i] = p[i][j];
+        }
+    }
+
+    batch_f(x, n, nn, y);
+}
+
 /* Main optimization function nelmin(...). */
 struct optimum *nelmin(const unsigned int  n,
                              double       *start,
@@ -49,6 +100,7 @@ struct optimum *nelmin(const unsigned int  n,
     unsigned int ifault; /* The error indicator.                            */
 
     unsigned int jcount;
+    unsigned int steps;  /* The number of simplex steps (for the trace).    */
     unsigned int nn;
     unsigned int i;
     unsigned int j;
@@ -73,14 +125,16 @@ struct optimum *nelmin(const unsigned int  n,
 
     opt = malloc(sizeof(struct optimum));
 
-    for (i = 0; i < n; i++) {
+    /* All of them: n is not checked against VARS yet. */
+    for (i = 0; i < VARS; i++) {
         opt->xmin[i] = 0;
     }
 
-    opt->ynewlo = icount = numres = 0;
+    opt->ynewlo = icount = numres = steps = 0;
 
     opt->indics[INDEX_0] = icount;
     opt->indics[INDEX_1] = numres;
+    opt->indics[INDEX_3] = steps;
 
     /* Check the input parameters. */
     if (reqmin <= 0) {
@@ -125,11 +179,14 @@ struct optimum *nelmin(const unsigned int  n,
     /* Construction of initial simplex. */
 L1000:;
 
+    /* The starting point is the last vertex, NN (1-based) in the paper. */
     for (i = 0; i < n; i++) {
-        p[i][nn] = start[i];
+        p[i][n] = start[i];
     }
 
-    y[nn] = f(start);
+    if (batch_f == NULL) {
+        y[n] = f(start);
+    }
 
     for (j = 0; j < n; j++) {
         x         = start[j];
@@ -139,11 +196,18 @@ L1000:;
             p[i][j] = start[i];
         }
 
-        y[j] = f(start);
+        if (batch_f == NULL) {
+            y[j] = f(start);
+        }
 
         start[j] = x;
     }
 
+    /* Or else all the vertices at once. */
+    if (batch_f != NULL) {
+        batch_simplex(p, n, nn, y);
+    }
+
     icount += nn;
 
     /* The simplex construction is complete. */
@@ -165,6 +229,18 @@ L1000:;
 
 L2000:;
 
+    steps++;
+
+    /* The best vertex at the start of the step goes to the trace. */
+    if (bin_trace != NULL) {
+        for (i = 0; i < n; i++) {
+            xmin[i] = p[i][ilo];
+        }
+
+        bin_trace_record(bin_trace, BIN_TRACE_ITERATION, steps, icount,
+                         ylo, xmin);
+    }
+
     ynewlo = y[INDEX_0];
     ihi    =   INDEX_0;
 
@@ -258,7 +334,13 @@ L2000:;
                         xmin[i] =  p[i][j];
                     }
 
-                    y[j] = f(xmin);
+                    if (batch_f == NULL) {
+                        y[j] = f(xmin);
+                    }
+                }
+
+                if (batch_f != NULL) {
+                    batch_simplex(p, n, nn, y);
                 }
 
                 icount += nn;
@@ -358,6 +440,11 @@ L3000:;
     if (kcount < icount) {
         ifault = IFAULT_2;
 
+        if (bin_trace != NULL) {
+            bin_trace_record(bin_trace, BIN_TRACE_SUMMARY, steps, icount,
+                             ynewlo, xmin);
+        }
+
         for (i = 0; i < n; i++) {
             opt->xmin[i] = xmin[i];
         }
@@ -367,6 +454,7 @@ L3000:;
         opt->indics[INDEX_0] = icount;
         opt->indics[INDEX_1] = numres;
         opt->indics[INDEX_2] = ifault;
+        opt->indics[INDEX_3] = steps;
 
         return (opt);
     }
@@ -405,6 +493,11 @@ L3000:;
 L4000:;
 
     if (ifault == 0) {
+        if (bin_trace != NULL) {
+            bin_trace_record(bin_trace, BIN_TRACE_SUMMARY, steps, icount,
+                             ynewlo, xmin);
+        }
+
         for (i = 0; i < n; i++) {
             opt->xmin[i] = xmin[i];
         }
@@ -414,6 +507,7 @@ L4000:;
         opt->indics[INDEX_0] = icount;
         opt->indics[INDEX_1] = numres;
         opt->indics[INDEX_2] = ifault;
+        opt->indics[INDEX_3] = steps;
 
         return (opt);
     }
@@ -430,8 +524,13 @@ L4000:;
     goto L1000;
 }
 
+/*
+ * The benchmark over the MGH test problems has a main() of its own
+ * (see mghbench.c).
+ */
+#ifndef MGH
 /* Main program function main() :-). */
-int main(void) {
+int main(int argc, char **argv) {
     unsigned int n;
     unsigned int konvge;
     unsigned int kcount;
@@ -448,6 +547,20 @@ int main(void) {
 
     struct optimum *opt;
 
+    const char       *trace_path = NULL;
+    struct bin_trace *trace      = NULL;
+
+    /* The only option: the binary trace file. */
+    if ((argc == 2) && (strncmp(argv[1], TRACE_BIN_OPTION,
+                                strlen(TRACE_BIN_OPTION)) == 0)) {
+
+        trace_path = argv[1] + strlen(TRACE_BIN_OPTION);
+    } else if (argc > 1) {
+        fprintf(stderr, "Usage: %s [%sPATH]\n", argv[0], TRACE_BIN_OPTION);
+
+        return EXIT_FAILURE;
+    }
+
 #ifndef WOODS
     /* Starting guess for Rosenbrock's test function. */
     puts("\nTEST01\n  Apply NELMIN to ROSENBROCK function.");
@@ -492,8 +605,29 @@ int main(void) {
 
     printf(  "\n  F(X)  = %14.6E    ->    %.12f\n", ynewlo, ynewlo);
 
+    /* There is no rho here: the header gets 0 and reqmin for epsilon. */
+    if (trace_path != NULL) {
+        trace = bin_trace_open(trace_path, BIN_TRACE_NELMIN, n, 0, reqmin);
+
+        if (trace == NULL) {
+            fprintf(stderr, "%s: cannot open %s\n", argv[0], trace_path);
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    set_bin_trace(trace);
+
     opt = nelmin(n, start, reqmin, step, konvge, kcount);
 
+    if ((trace != NULL) && (bin_trace_close(trace) != 0)) {
+        fprintf(stderr, "%s: cannot write %s\n", argv[0], trace_path);
+
+        free(opt);
+
+        return EXIT_FAILURE;
+    }
+
     for (i = 0; i < n; i++) {
         xmin[i] = opt->xmin[i];
     }
@@ -522,5 +656,6 @@ int main(void) {
 
     return EXIT_SUCCESS;
 }
+#endif
 
 /* vim:set nu et ts=4 sw=4: */
@@ -38,6 +38,9 @@
 #include <stdio.h>
 #include <math.h>
 
+/* The binary trace writer is the one of the Hooke and Jeeves C tree. */
+#include "../../../hooke-jeeves/c/src/bintrace.h"
+
 /** Constant. The maximum number of variables. */
 #define VARS 20
 
@@ -53,8 +56,11 @@
 /** Constant. The optimality factor. */
 #define EPS .001
 
+/** Constant. The binary trace command-line option (followed by a path). */
+#define TRACE_BIN_OPTION "--trace-bin="
+
 /** Helper constants. */
-#define INDICS_N       3
+#define INDICS_N       4
 
 #define INDEX_0        0
 #define INDEX_1        1
@@ -100,11 +106,44 @@ struct optimum {
      * <ul><li>The number of function evaluations used
      *                                (<code>icount</code>).</li>
      *     <li>The number of restarts (<code>numres</code>).</li>
-     *     <li>The error indicator    (<code>ifault</code>).</li></ul>
+     *     <li>The error indicator    (<code>ifault</code>).</li>
+     *     <li>The number of simplex steps (<code>steps</code>).</li></ul>
      */
     unsigned int indics[INDICS_N];
 };
 
+/**
+ * Setter for the binary trace.
+ * <br />
+ * <br />When set, <code>nelmin()</code> writes a record of the best vertex
+ * at the start of every simplex step and one of the optimum at the end
+ * into the binary trace.
+ *
+ * @param __bin_trace The binary trace (struct *), or <code>NULL</code>
+ *                    for none.
+ */
+extern void set_bin_trace(struct bin_trace *);
+
+/**
+ * Setter for the batch objective function.
+ * <br />
+ * <br />When set, <code>nelmin()</code> evaluates the vertices
+ * of the initial simplex and of a shrunk one all in one call to it,
+ * instead of one by one through <code>f()</code> (for an objective
+ * function whose evaluations overlap, e.g. an out-of-process one,
+ * see <code>evalpool.h</code>). It has to return exactly what
+ * <code>f()</code> would for every vertex.
+ *
+ * @param __batch_f The batch objective function (the n coordinates
+ *                  of vertex k at <code>x[k * n]</code>, its value
+ *                  into <code>y[k]</code>), or <code>NULL</code>
+ *                  for none.
+ */
+extern void set_batch_f(void (*)(const double *,
+                                 const unsigned int,
+                                 const unsigned int,
+                                 double *));
+
 /**
  * Main optimization function.
  * <br />
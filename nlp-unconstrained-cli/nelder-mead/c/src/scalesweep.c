@@ -0,0 +1,310 @@
+/*
+ * nlp-unconstrained-cli/nelder-mead/c/src/scalesweep.c
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the Nelder-Mead nonlinear unconstrained minimization algorithm.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+/* For clock_gettime() and wait4() (not in the C standard). */
+#define _DEFAULT_SOURCE
+
+#include <string.h>
+#include <time.h>
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "mgh.h"
+
+/* Helper constants (the sweep grid and the command-line options). */
+#define SCALE_N_DIMS       10
+#define SCALE_N_RHOS        3
+#define SCALE_N_FUNCS       2
+#define SCALE_HEADER       "solver,func,n,rho,vars_limit,status,iters," \
+                           "funevals,seconds,evals_per_s,f,peak_rss_kib," \
+                           "allocs"
+#define SCALE_ROW          "nelmin,%s,%u,%g,%u,%s,%u,%u,%.6f,%.6e,%.17g," \
+                           "%ld,%llu\n"
+#define MAX_VARS_OPTION    "--max-vars="
+#define CSV_OPTION         "--csv="
+#define NO_HEADER_OPTION   "--no-header"
+
+static const unsigned int SCALE_DIMS[SCALE_N_DIMS] = {
+    2, 4, 8, 12, 16, 20, 24, 28, 32, 64
+};
+
+static const double SCALE_RHOS[SCALE_N_RHOS] = {.25, .5, .75};
+
+/* The outcomes of a cell of the sweep (as the CSV has them). */
+enum scale_status {
+    SCALE_OK,
+    SCALE_MAX_EVALS,
+    SCALE_TOO_MANY_VARS,
+    SCALE_BAD_INPUT,
+    SCALE_CRASHED
+};
+
+static const char *const SCALE_STATUS[] = {
+    "ok", "max-evals", "too-many-vars", "bad-input", "crashed"
+};
+
+/*
+ * The results of a cell of the sweep (passed from the solving process
+ * back to the sweeping one as is).
+ */
+struct scale_cell {
+    unsigned int       status;
+    unsigned int       steps;
+    unsigned int       icount;
+    unsigned long long allocs;
+    double             seconds;
+    double             ynewlo;
+};
+
+/* The number of heap allocations made so far. */
+static unsigned long long allocs = 0;
+
+/*
+ * The allocation function the linker binds the malloc() calls to
+ * (see the -Wl,--wrap=malloc option in the Makefile): counts them.
+ */
+void *__real_malloc(size_t);
+
+void *__wrap_malloc(size_t size) {
+    allocs++;
+
+    return __real_malloc(size);
+}
+
+/*
+ * Helper function.
+ * Solves a problem once, in the child process: the initial simplex
+ * is set up the way Hooke and Jeeves set up their initial steps
+ * (|start[i] * rho|, or rho where start[i] is 0), so that the rho
+ * column means the same for both solvers.
+ */
+static void solve(const struct mgh_problem *problem,
+                  const double              rho,
+                  struct scale_cell        *c) {
+
+    unsigned int i;
+
+    double *start = malloc(problem->n * sizeof(double));
+    double *step  = malloc(problem->n * sizeof(double));
+
+    struct timespec t0;
+    struct timespec t1;
+
+    struct optimum *opt;
+
+    for (i = 0; i < problem->n; i++) {
+        start[i] = problem->start[i];
+        step[i]  = fabs(start[i] * rho);
+
+        if (step[i] == 0) {
+            step[i] = rho;
+        }
+    }
+
+    allocs = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+
+    opt = nelmin(problem->n, start, REQMIN_GUESS, step, KONVGE_GUESS,
+                 MGH_KCOUNT);
+
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    c->allocs  = allocs;
+    c->seconds = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1E9;
+    c->icount  = opt->indics[INDEX_0];
+    c->steps   = opt->indics[INDEX_3];
+    c->ynewlo  = opt->ynewlo;
+
+    if (opt->indics[INDEX_2] == IFAULT_0) {
+        c->status = SCALE_OK;
+    } else if (opt->indics[INDEX_2] == IFAULT_2) {
+        c->status = SCALE_MAX_EVALS;
+    } else if (problem->n > VARS) {
+        c->status = SCALE_TOO_MANY_VARS;
+    } else {
+        c->status = SCALE_BAD_INPUT;
+    }
+
+    free(opt);
+    free(step);
+    free(start);
+}
+
+/*
+ * Helper function.
+ * Runs a cell of the sweep in a child process, so that the peak
+ * resident set is the one of the solve alone and a solve which
+ * crashes shows up as such, and prints its CSV row.
+ * Returns 0 if the child cannot be started.
+ */
+static int cell(const struct mgh_problem *problem,
+                const double              rho,
+                FILE                     *out) {
+
+    int fds[2];
+    int status;
+
+    pid_t pid;
+
+    struct rusage usage;
+
+    struct scale_cell c;
+
+    if (pipe(fds) != 0) {
+        return 0;
+    }
+
+    /* Nothing buffered must get written twice. */
+    fflush(out);
+
+    if ((pid = fork()) < 0) {
+        close(fds[0]);
+        close(fds[1]);
+
+        return 0;
+    }
+
+    if (pid == 0) {
+        close(fds[0]);
+
+        mgh_select(problem);
+
+        solve(problem, rho, &c);
+
+        _exit((write(fds[1], &c, sizeof(c)) == sizeof(c))
+              ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    close(fds[1]);
+
+    if (read(fds[0], &c, sizeof(c)) != sizeof(c)) {
+        memset(&c, 0, sizeof(c));
+
+        c.status = SCALE_CRASHED;
+    }
+
+    close(fds[0]);
+
+    if (wait4(pid, &status, 0, &usage) < 0) {
+        memset(&usage, 0, sizeof(usage));
+    }
+
+    fprintf(out, SCALE_ROW, problem->name, problem->n, rho, VARS,
+            SCALE_STATUS[c.status], c.steps, c.icount, c.seconds,
+            (c.seconds > 0) ? (c.icount / c.seconds) : 0, c.ynewlo,
+            usage.ru_maxrss, c.allocs);
+
+    return 1;
+}
+
+/* Main program function main() :-). */
+int main(int argc, char **argv) {
+    int arg;
+    int ok     = 1;
+    int header = 1;
+
+    unsigned int d;
+    unsigned int r;
+    unsigned int k;
+    unsigned int i;
+    unsigned int max_vars = SCALE_DIMS[SCALE_N_DIMS - 1];
+
+    const char *csv = NULL;
+
+    FILE *out = stdout;
+
+    for (arg = 1; arg < argc; arg++) {
+        if (strcmp(argv[arg], NO_HEADER_OPTION) == 0) {
+            header = 0;
+        } else if (strncmp(argv[arg], MAX_VARS_OPTION,
+                           strlen(MAX_VARS_OPTION)) == 0) {
+
+            max_vars = atoi(argv[arg] + strlen(MAX_VARS_OPTION));
+        } else if (strncmp(argv[arg], CSV_OPTION, strlen(CSV_OPTION)) == 0) {
+            csv = argv[arg] + strlen(CSV_OPTION);
+        } else {
+            fprintf(stderr, "Usage: %s [%sN] [%sFILE] [%s]\n", argv[0],
+                    MAX_VARS_OPTION, CSV_OPTION, NO_HEADER_OPTION);
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    if ((csv != NULL) && ((out = fopen(csv, "w")) == NULL)) {
+        fprintf(stderr, "%s: cannot write %s\n", argv[0], csv);
+
+        return EXIT_FAILURE;
+    }
+
+    if (header) {
+        fprintf(out, "%s\n", SCALE_HEADER);
+    }
+
+    for (d = 0; ok && (d < SCALE_N_DIMS) && (SCALE_DIMS[d] <= max_vars);
+         d++) {
+
+        unsigned int n = SCALE_DIMS[d];
+
+        double *start = malloc(n * sizeof(double));
+
+        for (r = 0; ok && (r < SCALE_N_RHOS); r++) {
+            /* Rosenbrock and Woods, extended: their starts repeated. */
+            for (k = 0; ok && (k < SCALE_N_FUNCS); k++) {
+                struct mgh_problem problem = MGH_PROBLEMS[k];
+
+                /* Whole copies of the start only (Woods: whole blocks). */
+                if (n % problem.n != 0) {
+                    continue;
+                }
+
+                for (i = 0; i < n; i++) {
+                    start[i] = MGH_PROBLEMS[k].start[i % problem.n];
+                }
+
+                problem.n     = n;
+                problem.start = start;
+
+                ok = cell(&problem, SCALE_RHOS[r], out);
+            }
+        }
+
+        free(start);
+    }
+
+    if (!ok) {
+        fprintf(stderr, "%s: cannot start a solve\n", argv[0]);
+    }
+
+    if ((out != stdout) && (fclose(out) != 0)) {
+        fprintf(stderr, "%s: cannot write %s\n", argv[0], csv);
+
+        ok = 0;
+    }
+
+    return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/* vim:set nu et ts=4 sw=4: */
@@ -0,0 +1,441 @@
+/*
+ * nlp-unconstrained-cli/xbench/src/xbench.c
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the cross-implementation benchmark suite of the C-family builds.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+/* For syscall(), clock_gettime() and the like (not in the C standard). */
+#define _DEFAULT_SOURCE
+
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "xbench.h"
+
+/* The implementations, grouped by the algorithm (reference first). */
+static const struct xbench_impl IMPLS[] = {
+    {"hooke-jeeves", "__orig", "hooke-jeeves/__orig/bin/hooke",
+     XBENCH_HOOKE},
+    {"hooke-jeeves", "c",      "hooke-jeeves/c/bin/hooke",
+     XBENCH_HOOKE},
+    {"hooke-jeeves", "cc",     "hooke-jeeves/cc/bin/hooke",
+     XBENCH_HOOKE},
+    {"hooke-jeeves", "objc",   "hooke-jeeves/objc/bin/hooke",
+     XBENCH_HOOKE},
+    {"nelder-mead",  "__orig", "nelder-mead/__orig/bin/nelmin",
+     XBENCH_NELMIN},
+    {"nelder-mead",  "c",      "nelder-mead/c/bin/nelmin",
+     XBENCH_NELMIN}
+};
+
+#define N_IMPLS (sizeof(IMPLS) / sizeof(IMPLS[0]))
+
+/* The test problems (the suffixes of the executable names). */
+static const char *const PROBLEMS[] = {"rosenbrock", "woods"};
+static const char *const SUFFIXES[] = {"",           WOODS_SUFFIX};
+
+#define N_PROBLEMS (sizeof(PROBLEMS) / sizeof(PROBLEMS[0]))
+
+/*
+ * Helper function.
+ * Opens a hardware counter of a (stopped) process, counting in user
+ * space from its next exec() on, children included.
+ * Returns the counter descriptor, or -1 if there is none to be had
+ * (no PMU, as in most VMs, or perf_event_paranoid too strict).
+ */
+static int counter_open(const pid_t pid, const unsigned long long config) {
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+
+    attr.size           = sizeof(attr);
+    attr.type           = PERF_TYPE_HARDWARE;
+    attr.config         = config;
+    attr.disabled       = 1;
+    attr.enable_on_exec = 1;
+    attr.inherit        = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+
+    return syscall(SYS_perf_event_open, &attr, pid, -1, -1, 0);
+}
+
+/*
+ * Helper function.
+ * Reads and closes a hardware counter.
+ * Returns the count, or COUNTER_NONE if there is none.
+ */
+static long long counter_close(const int fd) {
+    long long count = COUNTER_NONE;
+
+    if (fd < 0) {
+        return COUNTER_NONE;
+    }
+
+    if (read(fd, &count, sizeof(count)) != sizeof(count)) {
+        count = COUNTER_NONE;
+    }
+
+    close(fd);
+
+    return count;
+}
+
+/*
+ * Helper function.
+ * Runs an executable once, its standard output going to a buffer
+ * (it never reaches the terminal: this is the quiet mode all the
+ * implementations share), and measures it.
+ * Returns 0 if it cannot be run or fails.
+ */
+static int run_once(const char *path, struct xbench_run *run) {
+    int out[2];
+    int go[2];
+    int status;
+    int fd_instr;
+    int fd_miss;
+
+    char c = 0;
+
+    size_t size = 0;
+
+    ssize_t n;
+
+    pid_t pid;
+
+    struct timespec t0;
+    struct timespec t1;
+
+    if (pipe(out) != 0) {
+        return 0;
+    }
+
+    if (pipe(go) != 0) {
+        close(out[0]);
+        close(out[1]);
+
+        return 0;
+    }
+
+    fflush(stdout);
+
+    if ((pid = fork()) < 0) {
+        close(out[0]);
+        close(out[1]);
+        close(go[0]);
+        close(go[1]);
+
+        return 0;
+    }
+
+    if (pid == 0) {
+        /* Waiting for the counters to be attached. */
+        close(go[1]);
+
+        if (read(go[0], &c, 1) != 1) {
+            _exit(EXIT_FAILURE);
+        }
+
+        close(go[0]);
+        close(out[0]);
+
+        dup2(out[1], STDOUT_FILENO);
+        close(out[1]);
+
+        execl(path, path, (char *) NULL);
+
+        _exit(EXIT_FAILURE);
+    }
+
+    close(go[0]);
+    close(out[1]);
+
+    fd_instr = counter_open(pid, PERF_COUNT_HW_INSTRUCTIONS);
+    fd_miss  = counter_open(pid, PERF_COUNT_HW_CACHE_MISSES);
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+
+    n = write(go[1], &c, 1);
+
+    close(go[1]);
+
+    while ((n == 1) && (size < XBENCH_OUTPUT_SIZE - 1)) {
+        ssize_t k = read(out[0], run->output + size,
+                         XBENCH_OUTPUT_SIZE - 1 - size);
+
+        if (k < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            break;
+        }
+
+        if (k == 0) {
+            break;
+        }
+
+        size += k;
+    }
+
+    close(out[0]);
+
+    waitpid(pid, &status, 0);
+
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    run->output[size] = '\0';
+    run->size         = size;
+    run->seconds      = (t1.tv_sec - t0.tv_sec)
+                      + (t1.tv_nsec - t0.tv_nsec) / 1E9;
+    run->instructions = counter_close(fd_instr);
+    run->cache_misses = counter_close(fd_miss);
+
+    return ((n == 1) && WIFEXITED(status)
+         && (WEXITSTATUS(status) == EXIT_SUCCESS));
+}
+
+/*
+ * Helper function.
+ * Picks the counts out of the output of an implementation:
+ * the Hooke and Jeeves ones print a line per improvement
+ * ("After N funevals...") and the number of iterations at the end,
+ * the Nelder-Mead ones the number of function evaluations
+ * (as the "Number of iterations") and of restarts.
+ * Returns 0 if the output has not got them.
+ */
+static int parse_counts(const struct xbench_impl *impl,
+                        const char               *output,
+                        struct xbench_counts     *counts) {
+
+    const char *p;
+
+    counts->iters    = COUNT_NONE;
+    counts->funevals = COUNT_NONE;
+    counts->restarts = COUNT_NONE;
+
+    if (impl->kind == XBENCH_HOOKE) {
+        for (p = output; (p = strstr(p, HOOKE_EVALS_KEY)) != NULL; p++) {
+            sscanf(p + strlen(HOOKE_EVALS_KEY), "%d", &counts->funevals);
+        }
+
+        if ((p = strstr(output, HOOKE_ITERS_KEY)) != NULL) {
+            sscanf(p + strlen(HOOKE_ITERS_KEY), "%d", &counts->iters);
+        }
+
+        return ((counts->iters != COUNT_NONE)
+             && (counts->funevals != COUNT_NONE));
+    }
+
+    if ((p = strstr(output, NELMIN_EVALS_KEY)) != NULL) {
+        sscanf(p + strlen(NELMIN_EVALS_KEY), " = %d", &counts->funevals);
+    }
+
+    if ((p = strstr(output, NELMIN_RESTARTS_KEY)) != NULL) {
+        sscanf(p + strlen(NELMIN_RESTARTS_KEY), " = %d", &counts->restarts);
+    }
+
+    return ((counts->funevals != COUNT_NONE)
+         && (counts->restarts != COUNT_NONE));
+}
+
+/* Helper function. Compares two doubles (for qsort()). */
+static int compare_seconds(const void *a, const void *b) {
+    double x = *(const double *) a;
+    double y = *(const double *) b;
+
+    return ((x > y) - (x < y));
+}
+
+/*
+ * Helper function.
+ * Prints a count column (or a dash for the ones an implementation
+ * does not report).
+ */
+static void print_count(const long long count, const int width) {
+    if (count == COUNTER_NONE) {
+        printf("%*s", width, "-");
+    } else {
+        printf("%*lld", width, count);
+    }
+}
+
+/*
+ * Helper function.
+ * Measures an implementation on a problem and checks its counts
+ * against the ones of the reference (the first implementation
+ * of the group having been run), printing a row of the table.
+ * Returns 0 on a mismatch or a failure.
+ */
+static int bench(const struct xbench_impl *impl,
+                 const unsigned int        problem,
+                 const char               *root,
+                 const unsigned int        reps,
+                 struct xbench_ref        *ref) {
+
+    unsigned int r;
+
+    char path[XBENCH_PATH_SIZE];
+
+    int match = 1;
+
+    const char *check;
+
+    double seconds[XBENCH_MAX_REPS];
+
+    struct xbench_run    best;
+    struct xbench_run    run;
+    struct xbench_counts counts;
+
+    snprintf(path, sizeof(path), "%s/%s%s", root, impl->path,
+             SUFFIXES[problem]);
+
+    printf(XBENCH_ROW_HEAD, impl->group, PROBLEMS[problem], impl->name);
+
+    if (access(path, X_OK) != 0) {
+        puts("   (not built)");
+
+        return 1;
+    }
+
+    for (r = 0; r < reps; r++) {
+        if (!run_once(path, &run)) {
+            puts("   (failed)");
+
+            return 0;
+        }
+
+        seconds[r] = run.seconds;
+
+        if ((r == 0) || (run.seconds < best.seconds)) {
+            best = run;
+        }
+    }
+
+    qsort(seconds, reps, sizeof(double), compare_seconds);
+
+    if (!parse_counts(impl, best.output, &counts)) {
+        puts("   (no counts in the output)");
+
+        return 0;
+    }
+
+    if (!ref->set) {
+        ref->set    = 1;
+        ref->counts = counts;
+        ref->size   = best.size;
+
+        memcpy(ref->output, best.output, best.size + 1);
+
+        check = CHECK_REF;
+    } else if (memcmp(&counts, &ref->counts, sizeof(counts)) != 0) {
+        check = CHECK_MISMATCH;
+        match = 0;
+    } else if ((best.size == ref->size)
+            && (memcmp(best.output, ref->output, best.size) == 0)) {
+
+        check = CHECK_SAME;
+    } else {
+        check = CHECK_SAME_COUNTS;
+    }
+
+    print_count(counts.iters,    7);
+    print_count(counts.funevals, 9);
+    print_count(counts.restarts, 9);
+
+    printf("%10.3f%10.3f", best.seconds * MS_PER_SECOND,
+           seconds[reps / 2] * MS_PER_SECOND);
+
+    print_count(best.instructions, 14);
+    print_count(best.cache_misses, 13);
+
+    printf("  %s\n", check);
+
+    return match;
+}
+
+/* Main program function main() :-). */
+int main(int argc, char **argv) {
+    int arg;
+    int ok = 1;
+
+    unsigned int k;
+    unsigned int p;
+    unsigned int reps = XBENCH_REPS;
+
+    const char *root = XBENCH_ROOT;
+
+    struct xbench_ref *ref;
+
+    for (arg = 1; arg < argc; arg++) {
+        if ((strncmp(argv[arg], REPS_OPTION, strlen(REPS_OPTION)) == 0)
+            && (atoi(argv[arg] + strlen(REPS_OPTION)) > 0)) {
+
+            reps = atoi(argv[arg] + strlen(REPS_OPTION));
+
+            if (reps > XBENCH_MAX_REPS) {
+                reps = XBENCH_MAX_REPS;
+            }
+        } else if (strncmp(argv[arg], ROOT_OPTION,
+                           strlen(ROOT_OPTION)) == 0) {
+
+            root = argv[arg] + strlen(ROOT_OPTION);
+        } else {
+            fprintf(stderr, "Usage: %s [%sREPS] [%sDIR]\n", argv[0],
+                    REPS_OPTION, ROOT_OPTION);
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    /* The reference output is kept on the heap (it is a large one). */
+    if ((ref = malloc(sizeof(struct xbench_ref))) == NULL) {
+        return EXIT_FAILURE;
+    }
+
+    puts(XBENCH_HEADER);
+
+    for (p = 0; p < N_PROBLEMS; p++) {
+        for (k = 0; k < N_IMPLS; k++) {
+            /* A new group: its first implementation run is the reference. */
+            if ((k == 0)
+                || (strcmp(IMPLS[k].group, IMPLS[k - 1].group) != 0)) {
+
+                ref->set = 0;
+            }
+
+            if (!bench(&IMPLS[k], p, root, reps, ref)) {
+                ok = 0;
+            }
+        }
+    }
+
+    free(ref);
+
+    return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/* vim:set nu et ts=4 sw=4: */
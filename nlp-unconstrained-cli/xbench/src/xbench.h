@@ -0,0 +1,163 @@
+/*
+ * nlp-unconstrained-cli/xbench/src/xbench.h
+ * ============================================================================
+ * Nonlinear Optimization Algorithms Multilang. Version 0.1.1
+ * ============================================================================
+ * Nonlinear programming algorithms as the (un-)constrained minimization
+ * problems with the focus on their numerical expression using various
+ * programming languages.
+ *
+ * This is the cross-implementation benchmark suite of the C-family builds.
+ * ============================================================================
+ * Written by Radislav (Radicchio) Golubtsov, 2015-2025
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * (See the LICENSE file at the top of the source tree.)
+ */
+
+/**
+ * The <code>xbench.h</code> header file contains the constants
+ * and the structures of the suite which runs the builds of the Hooke
+ * and Jeeves and of the Nelder-Mead algorithms on the same problems,
+ * checks that they get to the same counts and measures them.
+ *
+ * @author  Radislav (Radicchio) Golubtsov
+ * @version 0.1.1
+ * @since   xbench 0.1
+ */
+
+#ifndef __XBENCH__XBENCH_H
+#define __XBENCH__XBENCH_H
+
+#include <stdlib.h>
+#include <stdio.h>
+
+/** Constant. The default number of runs of every implementation. */
+#define XBENCH_REPS 5
+
+/** Constant. The maximum number of runs of every implementation. */
+#define XBENCH_MAX_REPS 1000
+
+/** Constant. The default directory the builds are looked up from. */
+#define XBENCH_ROOT ".."
+
+/** Constant. The room for the output of a run. */
+#define XBENCH_OUTPUT_SIZE 65536
+
+/** Constant. The room for the path of an executable. */
+#define XBENCH_PATH_SIZE 4096
+
+/** Constant. The suffix of the executables solving the Woods problem. */
+#define WOODS_SUFFIX "-woods"
+
+/** Constants. The keys the counts are picked out of the output by. */
+#define HOOKE_EVALS_KEY     "After "
+#define HOOKE_ITERS_KEY     "HOOKE USED "
+#define NELMIN_EVALS_KEY    "Number of iterations"
+#define NELMIN_RESTARTS_KEY "Number of restarts"
+
+/** Constants. The outcomes of the checks of the counts. */
+#define CHECK_REF         "ref"
+#define CHECK_SAME        "same"
+#define CHECK_SAME_COUNTS "same counts"
+#define CHECK_MISMATCH    "MISMATCH"
+
+/** Constants. The command-line options. */
+#define REPS_OPTION "--reps="
+#define ROOT_OPTION "--root="
+
+/** Constants. The table header and the start of its rows. */
+#define XBENCH_HEADER "algorithm     problem     impl     iters" \
+                      " funevals restarts   best ms    med ms" \
+                      "  instructions cache-misses  check"
+#define XBENCH_ROW_HEAD "%-13s %-11s %-6s"
+
+/** Helper constants. */
+#define COUNT_NONE    -1
+#define COUNTER_NONE  -1
+#define MS_PER_SECOND 1E3
+
+/** The kinds of the output the implementations print. */
+enum xbench_kind {
+    XBENCH_HOOKE,
+    XBENCH_NELMIN
+};
+
+/** An implementation (the executable solving the Rosenbrock problem). */
+struct xbench_impl {
+    /** The algorithm (the implementations of which are compared). */
+    const char *group;
+
+    /** The implementation name (its directory). */
+    const char *name;
+
+    /** The executable path (relative to the root directory). */
+    const char *path;
+
+    /** The kind of the output (<code>enum xbench_kind</code>). */
+    unsigned int kind;
+};
+
+/**
+ * The counts an implementation reports
+ * (<code>COUNT_NONE</code> for the ones it does not).
+ */
+struct xbench_counts {
+    /** The number of iterations. */
+    int iters;
+
+    /** The number of function evaluations. */
+    int funevals;
+
+    /** The number of restarts. */
+    int restarts;
+};
+
+/** A run of an implementation. */
+struct xbench_run {
+    /** The standard output (null-terminated). */
+    char output[XBENCH_OUTPUT_SIZE];
+
+    /** The size of the output. */
+    size_t size;
+
+    /** The wall time. */
+    double seconds;
+
+    /**
+     * The number of the instructions retired in user space
+     * (<code>COUNTER_NONE</code> if there is no counter to be had).
+     */
+    long long instructions;
+
+    /**
+     * The number of the cache misses in user space
+     * (<code>COUNTER_NONE</code> if there is no counter to be had).
+     */
+    long long cache_misses;
+};
+
+/** The reference run of an algorithm (the others are checked against). */
+struct xbench_ref {
+    /** Whether the reference has been run. */
+    int set;
+
+    /** The counts. */
+    struct xbench_counts counts;
+
+    /** The standard output (null-terminated). */
+    char output[XBENCH_OUTPUT_SIZE];
+
+    /** The size of the output. */
+    size_t size;
+};
+
+#endif /* __XBENCH__XBENCH_H */
+
+/* vim:set nu et ts=4 sw=4: */